@@ -5,6 +5,11 @@
 #include "SmokingMechanics.h"
 #include "PipeCrafting.h"
 #include "Haptics.h"
+#include "TaskPool.h"
+#include "TimerService.h"
+#include "ImadEngine.h"
+#include "ScaleEnforcer.h"
+#include "TrackingScheduler.h"
 #include "config.h"
 
 #include <skse64/PapyrusActor.cpp>
@@ -17,6 +22,9 @@
 
 namespace InteractivePipeSmokingVR
 {
+	// External task interface from main.cpp
+	extern SKSETaskInterface* g_task;
+
 	SKSETrampolineInterface* g_trampolineInterface = nullptr;
 
 	HiggsPluginAPI::IHiggsInterface001* higgsInterface;
@@ -775,6 +783,16 @@ namespace InteractivePipeSmokingVR
 		if (!isOpening)
 		{
 			loadConfig();
+
+			// Pick up a changed TrackingMode, zone radii, filter settings and touch duration without requiring a re-equip
+			if (g_vrInputTracker)
+			{
+				g_vrInputTracker->RefreshTrackingMode();
+				g_vrInputTracker->RefreshProximityRadii();
+				g_vrInputTracker->RefreshZones();
+				g_vrInputTracker->RefreshPositionFilters();
+				g_vrInputTracker->RefreshGestures();
+			}
 		}
 
 		return kEvent_Continue;
@@ -887,12 +905,24 @@ namespace InteractivePipeSmokingVR
 		// Apply scale for crafting items (when knife is equipped)
 		UpdateHeldCraftingItemScale();
 
+		// Frame-locked tracking: sample poses and run the detectors on this frame
+		if (g_vrInputTracker)
+		{
+			g_vrInputTracker->OnFrameUpdate();
+		}
+
 		// Continuously check pipe filling condition while holding a smokable
 		CheckPipeFillingCondition();
+
+		// Per-frame services (also driven without HIGGS, see StartFrameServicesFallback)
+		RunFrameServices();
 	}
 
 	void CheckPipeFillingCondition()
 	{
+		// "Ready to fill" feedback channel, refreshed while the condition holds
+		static const HapticSustainHandle fillingHaptic = RegisterSustainedHaptic("PipeFilling");
+
 		// Only check if we're holding a smokable ingredient
 		bool holdingSmokableLeft = (g_heldSmokableLeft != nullptr);
 		bool holdingSmokableRight = (g_heldSmokableRight != nullptr);
@@ -900,6 +930,7 @@ namespace InteractivePipeSmokingVR
 		
 		if (!holdingSmokable)
 		{
+			CancelSustainedHaptic(fillingHaptic);
 			g_pipeFillingConditionLogged = false;
 			return;
 		}
@@ -911,6 +942,7 @@ namespace InteractivePipeSmokingVR
 
 		if (!anyEmptyPipeEquipped)
 		{
+			CancelSustainedHaptic(fillingHaptic);
 			g_pipeFillingConditionLogged = false;
 			return;
 		}
@@ -922,7 +954,7 @@ namespace InteractivePipeSmokingVR
 		{
 			// All conditions met - trigger continuous weak haptic feedback on pipe hand
 			// This signals "ready to fill" - player must DROP the smokable to actually fill
-			TriggerHapticPulse(emptyPipeInLeft, emptyPipeInRight, 0.08f); // Weak continuous feedback
+			RefreshSustainedHaptic(fillingHaptic, emptyPipeInLeft, emptyPipeInRight, HapticPattern::Sustain); // Weak continuous feedback
 
 			if (!g_pipeFillingConditionLogged)
 			{
@@ -951,6 +983,8 @@ namespace InteractivePipeSmokingVR
 		}
 		else
 		{
+			CancelSustainedHaptic(fillingHaptic);
+
 			// Conditions no longer met - reset so we can log again when they re-enter the zone
 			if (g_pipeFillingConditionLogged)
 			{
@@ -960,6 +994,64 @@ namespace InteractivePipeSmokingVR
 		}
 	}
 
+	// ============================================
+	// Frame Services
+	// ============================================
+
+	// Only used without HIGGS - issues the next task only after the previous one has run,
+	// so at most one is queued (a task re-queueing itself would spin in the game's task drain)
+	static TrackingScheduler s_frameServicesScheduler;
+
+	class FrameServicesTask : public PooledTaskDelegate
+	{
+	public:
+		virtual void Run() override
+		{
+			RunFrameServices();
+			s_frameServicesScheduler.OnTickComplete();
+		}
+
+		virtual void Dispose() override
+		{
+			delete this;
+		}
+	};
+
+	// Scheduler tick callback (runs on the scheduler thread) - hand the services to the game thread
+	static void QueueFrameServicesTask()
+	{
+		if (g_task)
+		{
+			g_task->AddTask(new FrameServicesTask());
+		}
+		else
+		{
+			s_frameServicesScheduler.OnTickComplete();
+		}
+	}
+
+	void RunFrameServices()
+	{
+		// Fire any delayed actions (equips, renames) that are due
+		TimerService::GetSingleton().Tick();
+
+		// Advance IMAD fades and push changed strengths
+		ImadEngine::GetSingleton().Update();
+
+		// Pick up the lit pipe's glow node as its 3D attaches
+		UpdateGlowNodeDiscovery();
+	}
+
+	void StartFrameServicesFallback()
+	{
+		if (s_frameServicesScheduler.IsActive())
+			return;
+
+		s_frameServicesScheduler.Start(QueueFrameServicesTask, FRAME_SERVICES_INTERVAL_MS);
+		_MESSAGE("[FrameServices] No HIGGS post-update callback - running frame services from the task queue every %d ms",
+			FRAME_SERVICES_INTERVAL_MS);
+	}
+
 	void RegisterHiggsGrabCallback()
 	{
 		if (higgsInterface)
@@ -973,6 +1065,9 @@ namespace InteractivePipeSmokingVR
 		else
 		{
 			_MESSAGE("WARNING: Cannot register HIGGS callbacks - interface not available");
+
+			// Delayed actions, IMAD fades and glow node discovery still need a per-frame game-thread driver
+			StartFrameServicesFallback();
 		}
 	}
 
@@ -998,35 +1093,7 @@ namespace InteractivePipeSmokingVR
 		if (!IsRefrValid(refr))
 			return;
 
-		// Get the 3D root node for the reference
-		NiNode* rootNode = refr->GetNiNode();
-		if (!rootNode)
-		{
-			return;
-		}
-
-		// Set the scale on the root node's local transform
-		rootNode->m_localTransform.scale = targetScale;
-
-		// Also set world transform scale
-		rootNode->m_worldTransform.scale = targetScale;
-
-		// Recursively set scale on all child nodes as well
-		for (UInt32 i = 0; i < rootNode->m_children.m_size; ++i)
-		{
-			NiAVObject* child = rootNode->m_children.m_data[i];
-			if (child)
-			{
-				child->m_localTransform.scale = targetScale;
-				child->m_worldTransform.scale = targetScale;
-			}
-		}
-
-		// Force update of world transforms
-		NiAVObject::ControllerUpdateContext ctx;
-		ctx.flags = 0;
-		ctx.delta = 0;
-		rootNode->UpdateWorldData(&ctx);
+		ScaleEnforcer::GetSingleton().Apply(refr, targetScale);
 	}
 
 	void UpdateHeldSmokableScale()
@@ -1047,7 +1114,7 @@ namespace InteractivePipeSmokingVR
 				{
 					targetScale = 1.0f;
 				}
-				ShrinkSmokableIngredient(g_heldSmokableLeft, targetScale);
+				ScaleEnforcer::GetSingleton().Enforce(g_heldSmokableLeft, targetScale);
 			}
 		}
 		if (g_heldSmokableRight)
@@ -1065,7 +1132,7 @@ namespace InteractivePipeSmokingVR
 				{
 					targetScale = 1.0f;
 				}
-				ShrinkSmokableIngredient(g_heldSmokableRight, targetScale);
+				ScaleEnforcer::GetSingleton().Enforce(g_heldSmokableRight, targetScale);
 			}
 		}
 	}
@@ -1151,7 +1218,7 @@ namespace InteractivePipeSmokingVR
 				DeleteWorldObject(droppedSmokable);
 
 				// Trigger stronger haptic feedback on the hand with the empty pipe to confirm fill
-				TriggerHapticFeedback(emptyPipeInLeft, emptyPipeInRight, 0.5f, 0.3f);
+				TriggerHapticPattern(emptyPipeInLeft, emptyPipeInRight, HapticPattern::Confirm);
 				_MESSAGE("[PipeFill] -> Haptic feedback triggered on %s hand!", emptyPipeInLeft ? "LEFT" : "RIGHT");
 
 				// Unequip and remove the empty pipe dummy weapon, equip herb-filled pipe
@@ -1204,7 +1271,7 @@ namespace InteractivePipeSmokingVR
 				}
 
 				// Trigger haptic feedback on the hand with the Roll of Paper to confirm
-				TriggerHapticFeedback(hasRollOfPaperLeft, hasRollOfPaperRight, 0.5f, 0.3f);
+				TriggerHapticPattern(hasRollOfPaperLeft, hasRollOfPaperRight, HapticPattern::Confirm);
 				_MESSAGE("[SmokeRolling]   -> Haptic feedback triggered on %s hand!", hasRollOfPaperLeft ? "LEFT" : "RIGHT");
 
 				// Clear Roll of Paper tracking
@@ -1616,6 +1683,26 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("Interactive Pipe Smoking VR - Resetting Mod State");
 		_MESSAGE("==============================================");
 
+		// Log task pool and timer usage from the previous session
+		TaskPool::GetSingleton().DumpStats();
+		TimerService::GetSingleton().DumpStats();
+		ImadEngine::GetSingleton().DumpStats();
+		DumpHapticsStats();
+		ScaleEnforcer::GetSingleton().DumpStats();
+
+		// Drop delayed equips/renames/glow searches still pending from the previous session
+		int invalidatedTimers = TimerService::GetSingleton().InvalidatePending();
+		_MESSAGE("[Reset] Invalidated %d pending delayed actions", invalidatedTimers);
+
+		// The player's 3D is rebuilt on load - drop cached skeleton nodes
+		if (g_vrInputTracker)
+		{
+			g_vrInputTracker->InvalidateNodeCache();
+		}
+
+		// Held references and their 3D are gone after a load
+		ScaleEnforcer::GetSingleton().Clear();
+
 		// Reset the equipped smoke item counter FIRST (before unequipping)
 		ResetEquippedSmokeItemCount();
 
@@ -153,6 +153,14 @@ namespace InteractivePipeSmokingVR
 	// HIGGS grab callback registration (called from main.cpp after HIGGS interface is available)
 	void RegisterHiggsGrabCallback();
 
+	// Per-frame game-thread services (delayed actions, IMAD fades, glow node discovery). Run from the HIGGS post-update callback,
+	// or without HIGGS from a task the frame services scheduler queues once the previous one has run.
+	void RunFrameServices();
+	void StartFrameServicesFallback();
+
+	// Cadence of the frame services fallback (about one frame at 90 Hz)
+	constexpr int FRAME_SERVICES_INTERVAL_MS = 11;
+
 	// Helpers - UNLIT weapons
 	bool IsRolledSmokeWeapon(UInt32 formId);
 	bool IsHerbWoodenPipeWeapon(UInt32 formId); // Was IsEmptyPipeWeapon
@@ -1,12 +1,13 @@
 #include "EquipState.h"
 #include "Engine.h"
+#include "TaskPool.h"
+#include "TimerService.h"
 #include "VRInputTracker.h"
 #include "SmokingMechanics.h"
 #include "PipeCrafting.h"
 #include "skse64/GameReferences.h"
 #include "skse64/GameObjects.h"
 #include "skse64/PluginAPI.h"
-#include <thread>
 #include <chrono>
 
 namespace InteractivePipeSmokingVR
@@ -67,7 +68,7 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	// Delayed Equip Armor Task (runs on game thread after delay)
 	// ============================================
-	class DelayedEquipArmorTask : public TaskDelegate
+	class DelayedEquipArmorTask : public PooledTaskDelegate
 	{
 	public:
 		UInt32 m_armorFormId;
@@ -112,7 +113,7 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	// Delayed Equip Weapon Task (runs on game thread after delay)
 	// ============================================
-	class DelayedEquipWeaponTask : public TaskDelegate
+	class DelayedEquipWeaponTask : public PooledTaskDelegate
 	{
 	public:
 		UInt32 m_weaponFormId;
@@ -167,45 +168,62 @@ namespace InteractivePipeSmokingVR
 	};
 
 	// ============================================
-	// Thread function to delay then queue the equip task
+	// Delayed equip/rename timers (fire on the game thread via the TimerService)
 	// ============================================
-	static void DelayedEquipThread(UInt32 armorFormId, int delayMs)
+	static void OnDelayedEquipArmorTimer(const TimerPayload& payload)
 	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-		
 		if (g_task)
 		{
-			g_task->AddTask(new DelayedEquipArmorTask(armorFormId));
-			_MESSAGE("[EquipState] Queued equip task after %dms delay for armor %08X", delayMs, armorFormId);
+			g_task->AddTask(new DelayedEquipArmorTask(payload.formId));
+			_MESSAGE("[EquipState] Queued equip task after %dms delay for armor %08X", static_cast<int>(payload.param), payload.formId);
 		}
 	}
 
-	// ============================================
-	// Thread function to delay then queue the weapon equip task
-	// ============================================
-	static void DelayedEquipWeaponThread(UInt32 weaponFormId, bool equipToLeftHand, int delayMs)
+	static void OnDelayedEquipWeaponTimer(const TimerPayload& payload)
 	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-		
+		bool equipToLeftHand = (payload.param != 0);
 		if (g_task)
 		{
-			g_task->AddTask(new DelayedEquipWeaponTask(weaponFormId, equipToLeftHand));
+			g_task->AddTask(new DelayedEquipWeaponTask(payload.formId, equipToLeftHand));
 			_MESSAGE("[EquipState] Queued weapon equip task after %dms delay for weapon %08X to %s hand", 
-				delayMs, weaponFormId, equipToLeftHand ? "LEFT" : "RIGHT");
+				static_cast<int>(payload.value), payload.formId, equipToLeftHand ? "LEFT" : "RIGHT");
 		}
 	}
 
-	// Thread function to set weapon display name after a delay (after equip completes)
-	static void DelayedSetWeaponNameThread(UInt32 weaponFormId, const char* baseName, SmokableCategory category, int delayMs)
+	static void OnDelayedSetWeaponNameTimer(const TimerPayload& payload)
 	{
-		// Copy the base name since it might go out of scope
-		std::string baseNameCopy(baseName);
-		
-		std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-		
-		// Set the weapon display name on the main thread via task
-		SetWeaponDisplayName(weaponFormId, baseNameCopy.c_str(), category);
-		_MESSAGE("[WeaponName] Delayed set weapon %08X name after %dms", weaponFormId, delayMs);
+		SetWeaponDisplayName(payload.formId, payload.text, static_cast<SmokableCategory>(payload.param));
+		_MESSAGE("[WeaponName] Delayed set weapon %08X name after %dms", payload.formId, static_cast<int>(payload.value));
+	}
+
+	// Equip armor after a delay
+	static void ScheduleDelayedEquip(UInt32 armorFormId, int delayMs)
+	{
+		TimerService::GetSingleton().Schedule(delayMs, OnDelayedEquipArmorTimer, armorFormId, static_cast<UInt32>(delayMs));
+	}
+
+	// Equip weapon to a hand after a delay
+	static void ScheduleDelayedEquipWeapon(UInt32 weaponFormId, bool equipToLeftHand, int delayMs)
+	{
+		TimerPayload payload;
+		payload.formId = weaponFormId;
+		payload.param = equipToLeftHand ? 1 : 0;
+		payload.value = static_cast<float>(delayMs);
+		TimerService::GetSingleton().Schedule(delayMs, OnDelayedEquipWeaponTimer, payload);
+	}
+
+	// Set weapon display name after a delay (after equip completes) - base name is copied into the timer
+	static void ScheduleDelayedSetWeaponName(UInt32 weaponFormId, const char* baseName, SmokableCategory category, int delayMs)
+	{
+		TimerPayload payload;
+		payload.formId = weaponFormId;
+		payload.param = static_cast<UInt32>(category);
+		payload.value = static_cast<float>(delayMs);
+		if (baseName)
+		{
+			strncpy_s(payload.text, sizeof(payload.text), baseName, _TRUNCATE);
+		}
+		TimerService::GetSingleton().Schedule(delayMs, OnDelayedSetWeaponNameTimer, payload);
 	}
 
 	// ============================================
@@ -394,9 +412,8 @@ namespace InteractivePipeSmokingVR
 		AddItem_Native(nullptr, 0, playerRef, armorForm, 1, true);
 		_MESSAGE("[EquipState] Added armor %08X to inventory (silent)", armorFormId);
 
-		// Start a thread that waits 50ms then queues the equip task
-		std::thread equipThread(DelayedEquipThread, armorFormId, 15);
-		equipThread.detach();
+		// Schedule a timer that queues the equip task after 15ms
+		ScheduleDelayedEquip(armorFormId, 15);
 	}
 
 	void EquipStateManager::UnequipVisualArmor(UInt32 armorFormId)
@@ -563,15 +580,13 @@ namespace InteractivePipeSmokingVR
 					// Equip to the same hand as the empty pipe was
 					// Use game hand (wasInLeftHand/wasInRightHand) for equip since EquipItem uses game hands
 					bool equipToGameLeft = wasInLeftHand;
-					std::thread equipThread(DelayedEquipWeaponThread, herbWeaponFormId, equipToGameLeft, 20);
-					equipThread.detach();
+					ScheduleDelayedEquipWeapon(herbWeaponFormId, equipToGameLeft, 20);
 					_MESSAGE("[PipeFill] Scheduled %s to equip to game %s hand in 20ms", herbPipeBaseName, equipToGameLeft ? "LEFT" : "RIGHT");
 					
 					// Set the display name with category suffix AFTER equipping (100ms delay to ensure equip completes first)
 					if (smokableCategory != SmokableCategory::None)
 					{
-						std::thread nameThread(DelayedSetWeaponNameThread, herbWeaponFormId, herbPipeBaseName, smokableCategory, 100);
-						nameThread.detach();
+						ScheduleDelayedSetWeaponName(herbWeaponFormId, herbPipeBaseName, smokableCategory, 100);
 						_MESSAGE("[PipeFill] Scheduled weapon name update in 100ms");
 					}
 				}
@@ -691,8 +706,7 @@ namespace InteractivePipeSmokingVR
 					equipToGameLeftHand ? "LEFT" : "RIGHT");
 
 				// Equip the empty pipe to the correct game hand after a 20ms delay
-				std::thread equipThread(DelayedEquipWeaponThread, emptyWeaponFormId, equipToGameLeftHand, 20);
-				equipThread.detach();
+				ScheduleDelayedEquipWeapon(emptyWeaponFormId, equipToGameLeftHand, 20);
 				_MESSAGE("[PipeEmpty] Scheduled %s to equip to game %s hand in 20ms", emptyPipeName, equipToGameLeftHand ? "LEFT" : "RIGHT");
 			}
 			else
@@ -801,8 +815,7 @@ namespace InteractivePipeSmokingVR
 
 			// Equip the empty pipe to the same hand after a 15ms delay
 			bool equipToLeft = inLeftHand;
-			std::thread equipThread(DelayedEquipWeaponThread, emptyWeaponFormId, equipToLeft, 15);
-			equipThread.detach();
+			ScheduleDelayedEquipWeapon(emptyWeaponFormId, equipToLeft, 15);
 			_MESSAGE("[Deplete] Scheduled %s to equip to %s hand in 15ms", emptyName, equipToLeft ? "LEFT" : "RIGHT");
 		}
 		else
@@ -924,8 +937,7 @@ namespace InteractivePipeSmokingVR
 
 		// Re-equip the same item to the OPPOSITE game hand after a short delay
 		bool oppositeGameLeftHand = !gameLeftHand;
-		std::thread equipThread(DelayedEquipWeaponThread, equippedItem->formID, oppositeGameLeftHand, 15);
-		equipThread.detach();
+		ScheduleDelayedEquipWeapon(equippedItem->formID, oppositeGameLeftHand, 15);
 		_MESSAGE("[HandSwap] Scheduled re-equip to game %s hand in 50ms", oppositeGameLeftHand ? "LEFT" : "RIGHT");
 	}
 
@@ -1035,8 +1047,7 @@ namespace InteractivePipeSmokingVR
 			_MESSAGE("[Crafting] Added Empty Wooden Pipe to inventory");
 
 			// Equip after a short delay
-			std::thread equipThread(DelayedEquipWeaponThread, g_emptyWoodenPipeWeaponFullFormId, inLeftHand,15);
-			equipThread.detach();
+			ScheduleDelayedEquipWeapon(g_emptyWoodenPipeWeaponFullFormId, inLeftHand, 15);
 			_MESSAGE("[Crafting] Scheduled Empty Wooden Pipe to equip to %s hand in15ms", inLeftHand ? "LEFT" : "RIGHT");
 		}
 		else
@@ -1053,8 +1064,7 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[Crafting] Equipping Empty Wooden Pipe from inventory to %s hand", inLeftHand ? "LEFT" : "RIGHT");
 
 		// Equip after a short delay (item should already be in inventory)
-		std::thread equipThread(DelayedEquipWeaponThread, g_emptyWoodenPipeWeaponFullFormId, inLeftHand, 15);
-		equipThread.detach();
+		ScheduleDelayedEquipWeapon(g_emptyWoodenPipeWeaponFullFormId, inLeftHand, 15);
 		_MESSAGE("[Crafting] Scheduled Empty Wooden Pipe to equip to %s hand in 15ms", inLeftHand ? "LEFT" : "RIGHT");
 	}
 
@@ -1098,8 +1108,7 @@ namespace InteractivePipeSmokingVR
 			_MESSAGE("[Crafting] Added Empty Bone Pipe to inventory");
 
 			// Equip after a short delay
-			std::thread equipThread(DelayedEquipWeaponThread, g_emptyBonePipeWeaponFullFormId, inLeftHand,15);
-			equipThread.detach();
+			ScheduleDelayedEquipWeapon(g_emptyBonePipeWeaponFullFormId, inLeftHand, 15);
 			_MESSAGE("[Crafting] Scheduled Empty Bone Pipe to equip to %s hand in15ms", inLeftHand ? "LEFT" : "RIGHT");
 		}
 		else
@@ -1116,8 +1125,7 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[Crafting] Equipping Empty Bone Pipe from inventory to %s hand", inLeftHand ? "LEFT" : "RIGHT");
 
 		// Equip after a short delay (item should already be in inventory)
-		std::thread equipThread(DelayedEquipWeaponThread, g_emptyBonePipeWeaponFullFormId, inLeftHand, 15);
-		equipThread.detach();
+		ScheduleDelayedEquipWeapon(g_emptyBonePipeWeaponFullFormId, inLeftHand, 15);
 		_MESSAGE("[Crafting] Scheduled Empty Bone Pipe to equip to %s hand in 15ms", inLeftHand ? "LEFT" : "RIGHT");
 	}
 
@@ -1144,15 +1152,13 @@ namespace InteractivePipeSmokingVR
 			_MESSAGE("[SmokeRolling] Added Unlit Rolled Smoke to inventory");
 
 			// Equip after a short delay (20ms as requested)
-			std::thread equipThread(DelayedEquipWeaponThread, g_rolledSmokeWeaponFullFormId, inLeftHand, 20);
-			equipThread.detach();
+			ScheduleDelayedEquipWeapon(g_rolledSmokeWeaponFullFormId, inLeftHand, 20);
 			_MESSAGE("[SmokeRolling] Scheduled Unlit Rolled Smoke to equip to %s hand in 20ms", inLeftHand ? "LEFT" : "RIGHT");
 			
 			// Set the display name with category suffix AFTER equipping (100ms delay to ensure equip completes first)
 			if (g_filledRolledSmokeSmokableCategory != SmokableCategory::None)
 			{
-				std::thread nameThread(DelayedSetWeaponNameThread, g_rolledSmokeWeaponFullFormId, "Rolled Smoke", g_filledRolledSmokeSmokableCategory, 100);
-				nameThread.detach();
+				ScheduleDelayedSetWeaponName(g_rolledSmokeWeaponFullFormId, "Rolled Smoke", g_filledRolledSmokeSmokableCategory, 100);
 				_MESSAGE("[SmokeRolling] Scheduled weapon name update in 100ms");
 			}
 		}
@@ -1291,8 +1297,7 @@ namespace InteractivePipeSmokingVR
 
 			// Equip the lit pipe to the same hand after a 15ms delay
 			bool equipToLeft = inLeftHand;
-			std::thread equipThread(DelayedEquipWeaponThread, litWeaponFormId, equipToLeft, 15);
-			equipThread.detach();
+			ScheduleDelayedEquipWeapon(litWeaponFormId, equipToLeft, 15);
 			_MESSAGE("[Lighting] Scheduled %s to equip to %s hand in 15ms", litName, equipToLeft ? "LEFT" : "RIGHT");
 			
 			// Log which type-specific cache will be used when lit item is equipped
@@ -1363,8 +1368,7 @@ namespace InteractivePipeSmokingVR
 
 			// Equip the lit smoke to the same hand after a 15ms delay
 			bool equipToLeft = inLeftHand;
-			std::thread equipThread(DelayedEquipWeaponThread, g_rolledSmokeLitWeaponFullFormId, equipToLeft, 15);
-			equipThread.detach();
+			ScheduleDelayedEquipWeapon(g_rolledSmokeLitWeaponFullFormId, equipToLeft, 15);
 			_MESSAGE("[Lighting] Scheduled Rolled Smoke Lit to equip to %s hand in 15ms", equipToLeft ? "LEFT" : "RIGHT");
 			
 			_MESSAGE("[Lighting] Smokable effects will apply when smoking from ROLLED SMOKE cache: '%s' (%s)", 
@@ -1869,8 +1873,7 @@ namespace InteractivePipeSmokingVR
 					{
 						TESObjectREFR* playerRef = static_cast<TESObjectREFR*>(player);
 						AddItem_Native(nullptr, 0, playerRef, armorForm, 1, true);
-						std::thread equipThread(DelayedEquipThread, visualArmorFormId, 20);
-						equipThread.detach();
+						ScheduleDelayedEquip(visualArmorFormId, 20);
 						}
 				}
 			}
@@ -1994,8 +1997,7 @@ namespace InteractivePipeSmokingVR
 					{
 						TESObjectREFR* playerRef = static_cast<TESObjectREFR*>(player);
 						AddItem_Native(nullptr, 0, playerRef, armorForm, 1, true);
-						std::thread equipThread(DelayedEquipThread, visualArmorFormId, 25);
-						equipThread.detach();
+						ScheduleDelayedEquip(visualArmorFormId, 25);
 					}
 				}
 			}
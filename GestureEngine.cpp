@@ -0,0 +1,152 @@
+#include "GestureEngine.h"
+#include <climits>
+
+namespace InteractivePipeSmokingVR
+{
+	static_assert(GESTURE_MAX_GESTURES <= 31, "gesture masks");
+	static_assert(GESTURE_MAX_STAGES <= 32, "stage masks");
+
+	// ============================================
+	// GestureEngine Implementation
+	// ============================================
+
+	GestureEngine::GestureEngine()
+		: m_count(0)
+	{
+		Reset();
+	}
+
+	bool GestureEngine::SetGestures(const GestureDefinition* gestures, int count)
+	{
+		if (!gestures || count < 0 || count > GESTURE_MAX_GESTURES)
+			return false;
+
+		for (int g = 0; g < count; g++)
+		{
+			GestureDefinition& definition = m_definitions[g];
+			definition = gestures[g];
+
+			// Unused clause and stage slots never match / are never reached, so Step needs no counts
+			if (definition.clauseCount < 0)
+				definition.clauseCount = 0;
+			for (int c = definition.clauseCount; c < GESTURE_MAX_CLAUSES; c++)
+			{
+				definition.clauses[c].all = GESTURE_INPUT_NEVER;
+				definition.clauses[c].none = 0;
+			}
+
+			if (definition.stageCount < 0)
+				definition.stageCount = 0;
+			if (definition.stageCount > GESTURE_MAX_STAGES)
+				definition.stageCount = GESTURE_MAX_STAGES;
+			for (int s = 0; s < GESTURE_MAX_STAGES; s++)
+			{
+				if (s >= definition.stageCount)
+					definition.stageDelayMs[s] = INT_MAX;
+				else if (definition.stageDelayMs[s] < 0)
+					definition.stageDelayMs[s] = 0;
+			}
+		}
+		m_count = count;
+
+		// Holds in progress carry over (new delays apply from the next Step)
+		m_activeMask &= (1u << count) - 1;
+		return true;
+	}
+
+	void GestureEngine::Reset()
+	{
+		for (int g = 0; g < GESTURE_MAX_GESTURES; g++)
+		{
+			m_reachedStages[g] = 0;
+			m_newStages[g] = 0;
+		}
+		m_activeMask = 0;
+		m_startedMask = 0;
+		m_endedMask = 0;
+		m_prevInputs = 0;
+	}
+
+	void GestureEngine::Restart(int gesture)
+	{
+		if (gesture < 0 || gesture >= m_count)
+			return;
+
+		m_startTime[gesture] = std::chrono::steady_clock::now();
+		m_reachedStages[gesture] = 0;
+		m_newStages[gesture] = 0;
+	}
+
+	void GestureEngine::Step(UInt32 inputs, std::chrono::steady_clock::time_point now)
+	{
+		inputs &= ~GESTURE_INPUT_NEVER;
+		UInt32 risen = inputs & ~m_prevInputs;
+		m_prevInputs = inputs;
+
+		// Predicates: a gesture stays active while any clause matches, and may only start on its edge
+		UInt32 active = 0;
+		for (int g = 0; g < m_count; g++)
+		{
+			const GestureDefinition& definition = m_definitions[g];
+
+			UInt32 match = 0;
+			for (int c = 0; c < GESTURE_MAX_CLAUSES; c++)
+			{
+				const GestureClause& clause = definition.clauses[c];
+				match |= static_cast<UInt32>((inputs & clause.all) == clause.all) &
+					static_cast<UInt32>((inputs & clause.none) == 0);
+			}
+
+			UInt32 wasActive = (m_activeMask >> g) & 1;
+			UInt32 edge = static_cast<UInt32>((risen & definition.startEdge) == definition.startEdge);
+			active |= (match & (wasActive | edge)) << g;
+		}
+
+		m_startedMask = active & ~m_activeMask;
+		m_endedMask = m_activeMask & ~active;
+		m_activeMask = active;
+
+		// Stages: every stage whose delay the hold time has passed is reached; report the new ones
+		for (int g = 0; g < m_count; g++)
+		{
+			const GestureDefinition& definition = m_definitions[g];
+
+			if ((m_startedMask >> g) & 1)
+			{
+				m_startTime[g] = now;
+				m_reachedStages[g] = 0;
+			}
+
+			UInt32 isActive = (active >> g) & 1;
+			long long heldMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_startTime[g]).count();
+
+			UInt32 reached = 0;
+			for (int s = 0; s < GESTURE_MAX_STAGES; s++)
+			{
+				reached |= static_cast<UInt32>(heldMs >= definition.stageDelayMs[s]) << s;
+			}
+
+			// Inactive gestures keep the stages of their last hold
+			UInt32 keep = isActive - 1;   // All bits when inactive, none when active
+			reached = (reached & ~keep) | (m_reachedStages[g] & keep);
+
+			m_newStages[g] = reached & ~m_reachedStages[g];
+			m_reachedStages[g] = reached;
+		}
+	}
+
+	bool GestureEngine::IsComplete(int gesture) const
+	{
+		UInt32 allStages = (1u << m_definitions[gesture].stageCount) - 1;
+		return (m_reachedStages[gesture] & allStages) == allStages;
+	}
+
+	int GestureEngine::GetHeldMs(int gesture) const
+	{
+		if (!IsActive(gesture))
+			return 0;
+
+		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime[gesture]);
+		return static_cast<int>(duration.count());
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Gesture Engine
+	// Hold gestures declared as data instead of hand-written detectors. A gesture is
+	// a predicate on the per-tick input mask (zone memberships plus equip/pose flags,
+	// one bit each) and a list of timed stages. It starts when its predicate becomes
+	// true (optionally only on a tick where given input bits rise), reaches each stage
+	// once when held for the stage delay, and ends when the predicate drops. Every
+	// gesture is stepped from one table per tick with mask arithmetic; the results
+	// (started, active, ended gestures and newly reached stages) are bitmasks the
+	// caller dispatches to its handlers.
+	// ============================================
+
+	constexpr int GESTURE_MAX_GESTURES = 16;
+	constexpr int GESTURE_MAX_STAGES = 4;
+	constexpr int GESTURE_MAX_CLAUSES = 2;
+
+	// Reserved input bit, never set by Step - unused clause slots require it so they never match
+	constexpr UInt32 GESTURE_INPUT_NEVER = 0x80000000;
+
+	// Predicate clause: matches when every 'all' bit is set and no 'none' bit is set
+	struct GestureClause
+	{
+		UInt32 all;
+		UInt32 none;
+	};
+
+	struct GestureDefinition
+	{
+		const char* name;
+		int clauseCount;                              // The gesture is active while any clause matches
+		GestureClause clauses[GESTURE_MAX_CLAUSES];
+		UInt32 startEdge;                             // Input bits that must rise on the starting tick (0 = any tick)
+		int stageCount;
+		int stageDelayMs[GESTURE_MAX_STAGES];         // Hold time to reach each stage
+	};
+
+	class GestureEngine
+	{
+	public:
+		GestureEngine();
+
+		// Replace the gesture table (gesture index = table index). Holds in progress are kept.
+		// Returns false if the table does not fit.
+		bool SetGestures(const GestureDefinition* gestures, int count);
+
+		// Forget all runtime state without reporting ended gestures
+		void Reset();
+
+		// Restart one gesture's hold: its timer starts over and its stages are reached again.
+		// An active gesture stays active (no start/end reported).
+		void Restart(int gesture);
+
+		// Step every gesture against this tick's inputs
+		void Step(UInt32 inputs, std::chrono::steady_clock::time_point now);
+
+		// Results of the last Step, one bit per gesture
+		UInt32 GetActiveMask() const { return m_activeMask; }
+		UInt32 GetStartedMask() const { return m_startedMask; }
+		UInt32 GetEndedMask() const { return m_endedMask; }
+
+		// Stages (one bit each) first reached on the last Step
+		UInt32 GetNewStages(int gesture) const { return m_newStages[gesture]; }
+
+		// Stages reached by the current hold (or the last one, once it ended)
+		UInt32 GetReachedStages(int gesture) const { return m_reachedStages[gesture]; }
+
+		bool IsActive(int gesture) const { return (m_activeMask >> gesture) & 1; }
+		bool HasReachedStage(int gesture, int stage) const { return IsActive(gesture) && ((m_reachedStages[gesture] >> stage) & 1); }
+
+		// True if the last hold reached every stage
+		bool IsComplete(int gesture) const;
+
+		// How long the gesture has been held (0 if not active)
+		int GetHeldMs(int gesture) const;
+
+		int GetCount() const { return m_count; }
+		const char* GetName(int gesture) const { return m_definitions[gesture].name; }
+
+	private:
+		GestureDefinition m_definitions[GESTURE_MAX_GESTURES];
+		int m_count;
+
+		std::chrono::steady_clock::time_point m_startTime[GESTURE_MAX_GESTURES];
+		UInt32 m_reachedStages[GESTURE_MAX_GESTURES];
+		UInt32 m_newStages[GESTURE_MAX_GESTURES];
+
+		UInt32 m_activeMask;
+		UInt32 m_startedMask;
+		UInt32 m_endedMask;
+		UInt32 m_prevInputs;
+	};
+}
@@ -0,0 +1,234 @@
+#include "HapticPatternBank.h"
+#include "config.h"
+#include <cstring>
+#include <Windows.h>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Built-in patterns (used when the bank file is missing or lacks a pattern)
+	// Same values as Tools/HapticPatterns.txt
+	// ============================================
+
+	static const char* kPatternNames[static_cast<int>(HapticPattern::Count)] = {
+		"Sustain", "Notify", "Confirm", "HandSwap"
+	};
+
+	// 0.08 flat
+	static const UInt8 kBuiltinSustain[] = { 20, 20 };
+
+	// 0.3 flat
+	static const UInt8 kBuiltinNotify[] = { 77, 77 };
+
+	// 0.5 flat
+	static const UInt8 kBuiltinConfirm[] = { 128, 128 };
+
+	// 0.8 flat (the hand swap countdown plays it twice)
+	static const UInt8 kBuiltinHandSwap[] = { 204, 204 };
+
+	static const HapticPatternData kBuiltinPatterns[static_cast<int>(HapticPattern::Count)] = {
+		{ kBuiltinSustain, sizeof(kBuiltinSustain), 0.022f },
+		{ kBuiltinNotify, sizeof(kBuiltinNotify), 0.2f },
+		{ kBuiltinConfirm, sizeof(kBuiltinConfirm), 0.3f },
+		{ kBuiltinHandSwap, sizeof(kBuiltinHandSwap), 0.15f }
+	};
+
+	// ============================================
+	// HapticPatternBank Implementation
+	// ============================================
+
+	HapticPatternBank& HapticPatternBank::GetSingleton()
+	{
+		static HapticPatternBank instance;
+		return instance;
+	}
+
+	HapticPatternBank::HapticPatternBank()
+		: m_file(nullptr)
+		, m_mapping(nullptr)
+		, m_view(nullptr)
+		, m_viewSize(0)
+	{
+		ResolveBuiltins();
+	}
+
+	HapticPatternBank::~HapticPatternBank()
+	{
+		Unload();
+	}
+
+	void HapticPatternBank::ResolveBuiltins()
+	{
+		for (int i = 0; i < static_cast<int>(HapticPattern::Count); i++)
+		{
+			m_patterns[i] = kBuiltinPatterns[i];
+		}
+	}
+
+	bool HapticPatternBank::MapFile(const char* path)
+	{
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(HapticBankHeader)))
+		{
+			_MESSAGE("[HapticBank] ERROR: %s is too small to be a pattern bank", path);
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			_MESSAGE("[HapticBank] ERROR: Could not map %s (error %lu)", path, GetLastError());
+			CloseHandle(file);
+			return false;
+		}
+
+		const UInt8* view = static_cast<const UInt8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!view)
+		{
+			_MESSAGE("[HapticBank] ERROR: Could not map a view of %s (error %lu)", path, GetLastError());
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		size_t size = static_cast<size_t>(fileSize.QuadPart);
+
+		// Validate the header and that every table/sample range lies inside the file
+		const HapticBankHeader* header = reinterpret_cast<const HapticBankHeader*>(view);
+		size_t tableBytes = static_cast<size_t>(header->patternCount) * sizeof(HapticBankEntry);
+		bool valid = header->magic == HAPTIC_BANK_MAGIC &&
+			header->version == HAPTIC_BANK_VERSION &&
+			header->patternCount <= HAPTIC_BANK_MAX_PATTERNS &&
+			sizeof(HapticBankHeader) + tableBytes + header->sampleBytes <= size;
+
+		if (!valid)
+		{
+			_MESSAGE("[HapticBank] ERROR: %s is not a valid version %u pattern bank", path, HAPTIC_BANK_VERSION);
+			UnmapViewOfFile(view);
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_file = file;
+		m_mapping = mapping;
+		m_view = view;
+		m_viewSize = size;
+		return true;
+	}
+
+	void HapticPatternBank::Load()
+	{
+		Unload();
+
+		std::string runtimeDirectory = GetRuntimeDirectory();
+		if (runtimeDirectory.empty())
+		{
+			_MESSAGE("[HapticBank] Runtime directory unknown - using built-in patterns");
+			return;
+		}
+
+		std::string path = runtimeDirectory + "Data\\SKSE\\Plugins\\InteractivePipeSmokingVR.hapticbank";
+		if (!MapFile(path.c_str()))
+		{
+			_MESSAGE("[HapticBank] No pattern bank at %s - using built-in patterns", path.c_str());
+			return;
+		}
+
+		const HapticBankHeader* header = reinterpret_cast<const HapticBankHeader*>(m_view);
+		const HapticBankEntry* entries = reinterpret_cast<const HapticBankEntry*>(m_view + sizeof(HapticBankHeader));
+		const UInt8* samples = m_view + sizeof(HapticBankHeader) + header->patternCount * sizeof(HapticBankEntry);
+
+		// Resolve every pattern by name once - playback only indexes m_patterns
+		for (int p = 0; p < static_cast<int>(HapticPattern::Count); p++)
+		{
+			bool found = false;
+			for (UInt32 e = 0; e < header->patternCount; e++)
+			{
+				const HapticBankEntry& entry = entries[e];
+				if (strncmp(entry.name, kPatternNames[p], HAPTIC_BANK_NAME_LENGTH) != 0)
+					continue;
+
+				if (entry.sampleCount == 0 || entry.sampleOffset > header->sampleBytes ||
+					entry.sampleCount > header->sampleBytes - entry.sampleOffset || !(entry.durationSeconds >= 0.0f))
+				{
+					_MESSAGE("[HapticBank] WARNING: Pattern '%s' is malformed - using built-in", kPatternNames[p]);
+					break;
+				}
+
+				m_patterns[p].samples = samples + entry.sampleOffset;
+				m_patterns[p].sampleCount = entry.sampleCount;
+				m_patterns[p].durationSeconds = entry.durationSeconds;
+				found = true;
+				break;
+			}
+
+			_MESSAGE("[HapticBank] Pattern '%s': %u samples over %.3fs (%s)", kPatternNames[p],
+				m_patterns[p].sampleCount, m_patterns[p].durationSeconds, found ? "bank" : "built-in");
+		}
+
+		_MESSAGE("[HapticBank] Mapped %s (%u patterns, %u sample bytes)", path.c_str(), header->patternCount, header->sampleBytes);
+	}
+
+	void HapticPatternBank::Unload()
+	{
+		ResolveBuiltins();
+
+		if (m_view)
+		{
+			UnmapViewOfFile(m_view);
+			m_view = nullptr;
+			m_viewSize = 0;
+		}
+		if (m_mapping)
+		{
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+		if (m_file)
+		{
+			CloseHandle(m_file);
+			m_file = nullptr;
+		}
+	}
+
+	const HapticPatternData& HapticPatternBank::Get(HapticPattern pattern) const
+	{
+		int index = static_cast<int>(pattern);
+		if (index < 0 || index >= static_cast<int>(HapticPattern::Count))
+			index = 0;
+		return m_patterns[index];
+	}
+
+	float HapticPatternBank::GetPeak(HapticPattern pattern) const
+	{
+		const HapticPatternData& data = Get(pattern);
+		UInt8 peak = 0;
+		for (UInt32 i = 0; i < data.sampleCount; i++)
+		{
+			if (data.samples[i] > peak)
+				peak = data.samples[i];
+		}
+		return peak / 255.0f;
+	}
+
+	float HapticPatternBank::Sample(const HapticPatternData& data, float t)
+	{
+		if (data.sampleCount == 1 || t <= 0.0f)
+			return data.samples[0] / 255.0f;
+
+		float position = t * (data.sampleCount - 1);
+		UInt32 index = static_cast<UInt32>(position);
+		if (index >= data.sampleCount - 1)
+			return data.samples[data.sampleCount - 1] / 255.0f;
+
+		float a = data.samples[index];
+		float b = data.samples[index + 1];
+		return (a + (b - a) * (position - index)) / 255.0f;
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Haptic Pattern Bank
+	// Named haptic patterns, each a sampled 8-bit strength curve played over a duration.
+	// The bank is a binary file next to the INI (Data\SKSE\Plugins\InteractivePipeSmokingVR.hapticbank),
+	// memory-mapped and validated once at load - playing a pattern is an index lookup and
+	// a sample interpolation, no parsing. Patterns missing from the file (or no file at all)
+	// use the built-in defaults. The bank is compiled from a text description by
+	// Tools/HapticBankCompiler.cpp.
+	//
+	// File layout (little-endian, packed):
+	//   HapticBankHeader
+	//   HapticBankEntry[patternCount]
+	//   UInt8 samples[sampleBytes]    (0 = off, 255 = full strength)
+	// ============================================
+
+	constexpr UInt32 HAPTIC_BANK_MAGIC = 0x42485049;   // "IPHB" read as a little-endian UInt32
+	constexpr UInt32 HAPTIC_BANK_VERSION = 1;
+	constexpr int HAPTIC_BANK_NAME_LENGTH = 24;
+
+	// Sanity limit on the pattern table size of a bank file
+	constexpr UInt32 HAPTIC_BANK_MAX_PATTERNS = 1024;
+
+#pragma pack(push, 1)
+	struct HapticBankHeader
+	{
+		UInt32 magic;
+		UInt32 version;
+		UInt32 patternCount;
+		UInt32 sampleBytes;
+	};
+
+	struct HapticBankEntry
+	{
+		char name[HAPTIC_BANK_NAME_LENGTH];   // Null-padded
+		UInt32 sampleOffset;                  // Into the sample block
+		UInt32 sampleCount;                   // >= 1, spread evenly over the duration
+		float durationSeconds;
+	};
+#pragma pack(pop)
+
+	// Patterns the plugin plays, looked up by name in the bank at load
+	enum class HapticPattern : UInt32
+	{
+		Sustain = 0,   // Weak continuous "condition met" feedback (lighting, filling, rolling)
+		Notify,        // Short flat buzz (pipe emptied)
+		Confirm,       // Medium flat confirmation (lit, filled, rolled)
+		HandSwap,      // Strong flat pulse (hand swap countdown, played at each stage)
+		Count
+	};
+
+	// A resolved pattern - points into the mapped file or the built-in table
+	struct HapticPatternData
+	{
+		const UInt8* samples;
+		UInt32 sampleCount;
+		float durationSeconds;
+	};
+
+	class HapticPatternBank
+	{
+	public:
+		static HapticPatternBank& GetSingleton();
+
+		// Map the bank file and resolve every pattern. Call before the haptics driver starts.
+		void Load();
+
+		// Release the mapping (patterns fall back to built-ins). Call after the haptics driver stopped.
+		void Unload();
+
+		const HapticPatternData& Get(HapticPattern pattern) const;
+
+		// Highest strength in a pattern (0..1) - used as the level of sustained channels
+		float GetPeak(HapticPattern pattern) const;
+
+		// Strength (0..1) at phase t (0..1), interpolated between samples
+		static float Sample(const HapticPatternData& data, float t);
+
+		bool IsMapped() const { return m_view != nullptr; }
+
+	private:
+		HapticPatternBank();
+		~HapticPatternBank();
+		HapticPatternBank(const HapticPatternBank&) = delete;
+		HapticPatternBank& operator=(const HapticPatternBank&) = delete;
+
+		// Map and validate the file; false leaves nothing mapped
+		bool MapFile(const char* path);
+
+		void ResolveBuiltins();
+
+		void* m_file;      // HANDLE
+		void* m_mapping;   // HANDLE
+		const UInt8* m_view;
+		size_t m_viewSize;
+
+		HapticPatternData m_patterns[static_cast<int>(HapticPattern::Count)];
+	};
+}
@@ -3,6 +3,8 @@
 
 #include <chrono>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 
 // Prevent Windows min/max macros from conflicting with std::min/max
 #undef min
@@ -15,6 +17,19 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	HapticsManager* g_hapticsLeft = nullptr;
 	HapticsManager* g_hapticsRight = nullptr;
+	HapticsDriver* g_hapticsDriver = nullptr;
+
+	// ============================================
+	// Sustained channel registry (game thread)
+	// ============================================
+	struct SustainedChannel
+	{
+		char name[32];
+		UInt64 refreshes;
+		UInt64 coalesced;
+	};
+	static SustainedChannel s_sustainedChannels[HAPTIC_MAX_SUSTAINED];
+	static int s_sustainedChannelCount = 0;
 
 	// ============================================
 	// Helper to get current time in seconds
@@ -34,36 +49,135 @@ namespace InteractivePipeSmokingVR
 		return a + (b - a) * t;
 	}
 
+	// ============================================
+	// Envelope lookup tables (sampled once)
+	// ============================================
+	struct HapticEnvelopeTables
+	{
+		float samples[static_cast<int>(HapticEnvelope::Count)][HAPTIC_ENVELOPE_SAMPLES];
+
+		HapticEnvelopeTables()
+		{
+			const int linear = static_cast<int>(HapticEnvelope::Linear);
+			const int attackDecay = static_cast<int>(HapticEnvelope::AttackDecay);
+			const int pulseTrain = static_cast<int>(HapticEnvelope::PulseTrain);
+
+			for (int i = 0; i < HAPTIC_ENVELOPE_SAMPLES; i++)
+			{
+				float t = static_cast<float>(i) / (HAPTIC_ENVELOPE_SAMPLES - 1);
+
+				samples[linear][i] = 1.0f;
+
+				// Linear attack, then exponential decay to ~2% at the end
+				if (t < HAPTIC_ATTACK_FRACTION)
+					samples[attackDecay][i] = t / HAPTIC_ATTACK_FRACTION;
+				else
+					samples[attackDecay][i] = std::exp(-4.0f * (t - HAPTIC_ATTACK_FRACTION) / (1.0f - HAPTIC_ATTACK_FRACTION));
+
+				// Square bursts
+				float burstPhase = t * HAPTIC_PULSE_TRAIN_PULSES;
+				burstPhase -= std::floor(burstPhase);
+				samples[pulseTrain][i] = (burstPhase < HAPTIC_PULSE_TRAIN_DUTY) ? 1.0f : 0.0f;
+			}
+		}
+	};
+
+	static const HapticEnvelopeTables& GetEnvelopeTables()
+	{
+		static HapticEnvelopeTables tables;
+		return tables;
+	}
+
+	// Envelope value at phase t (0..1), interpolated between table samples
+	static float EvaluateEnvelope(HapticEnvelope envelope, float t)
+	{
+		const float* table = GetEnvelopeTables().samples[static_cast<int>(envelope)];
+
+		float position = t * (HAPTIC_ENVELOPE_SAMPLES - 1);
+		int index = static_cast<int>(position);
+		if (index >= HAPTIC_ENVELOPE_SAMPLES - 1)
+			return table[HAPTIC_ENVELOPE_SAMPLES - 1];
+		if (index < 0)
+			return table[0];
+
+		return Lerp(table[index], table[index + 1], position - index);
+	}
+
+	// ============================================
+	// HapticEventRing Implementation
+	// ============================================
+
+	HapticEventRing::HapticEventRing()
+		: m_head(0)
+		, m_tail(0)
+		, m_pushed(0)
+		, m_overflows(0)
+	{
+	}
+
+	bool HapticEventRing::Push(const HapticEvent& hapticEvent)
+	{
+		UInt32 head = m_head.load(std::memory_order_relaxed);
+		UInt32 tail = m_tail.load(std::memory_order_acquire);
+
+		if (head - tail >= kCapacity)
+		{
+			m_overflows.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		m_slots[head & (kCapacity - 1)] = hapticEvent;
+
+		// Sequentially consistent so it is ordered against the driver's idle check (see HapticsDriver::NotifyWork)
+		m_head.store(head + 1, std::memory_order_seq_cst);
+		m_pushed.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool HapticEventRing::Pop(HapticEvent& hapticEvent)
+	{
+		UInt32 tail = m_tail.load(std::memory_order_relaxed);
+		UInt32 head = m_head.load(std::memory_order_acquire);
+
+		if (tail == head)
+			return false;
+
+		hapticEvent = m_slots[tail & (kCapacity - 1)];
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool HapticEventRing::IsEmpty() const
+	{
+		return m_head.load(std::memory_order_seq_cst) == m_tail.load(std::memory_order_acquire);
+	}
+
 	// ============================================
 	// HapticsManager Implementation
 	// ============================================
 
 	HapticsManager::HapticsManager(BSVRInterface::BSControllerHand hand)
 		: m_hand(hand)
-		, m_running(true)
-		, m_thread(&HapticsManager::Loop, this)
+		, m_activeCount(0)
+		, m_mixerOverflows(0)
+		, m_activeHighWaterMark(0)
+		, m_lastPassTime(-1.0)
+		, m_passIntervals(HistogramScale::Pacing)
 	{
+		// Build the envelope tables here rather than on the driver thread's first event
+		GetEnvelopeTables();
+
+		for (int i = 0; i < HAPTIC_MAX_SUSTAINED; i++)
+		{
+			m_sustained[i].strength.store(0.0f);
+			m_sustained[i].expiry.store(0.0);
+		}
 		_MESSAGE("[Haptics] Created HapticsManager for %s hand", 
 			hand == BSVRInterface::kControllerHand_Left ? "LEFT" : "RIGHT");
 	}
 
 	HapticsManager::~HapticsManager()
 	{
-		Shutdown();
-	}
-
-	void HapticsManager::Shutdown()
-	{
-		if (m_running)
-		{
-			m_running = false;
-			if (m_thread.joinable())
-			{
-				m_thread.join();
-			}
-			_MESSAGE("[Haptics] Shutdown HapticsManager for %s hand",
-				m_hand == BSVRInterface::kControllerHand_Left ? "LEFT" : "RIGHT");
-		}
 	}
 
 	void HapticsManager::TriggerHapticPulse(float duration)
@@ -75,18 +189,26 @@ namespace InteractivePipeSmokingVR
 		}
 	}
 
-	void HapticsManager::QueueHapticEvent(float startStrength, float endStrength, float duration)
+	void HapticsManager::QueueHapticEvent(float startStrength, float endStrength, float duration, HapticEnvelope envelope)
 	{
+		if (envelope >= HapticEnvelope::Count)
+			envelope = HapticEnvelope::Linear;
+
 		HapticEvent hapticEvent;
 		hapticEvent.startStrength = startStrength;
 		hapticEvent.endStrength = endStrength;
 		hapticEvent.duration = duration;
-		hapticEvent.isNew = true;
 		hapticEvent.startTime = 0;
+		hapticEvent.envelope = envelope;
+		hapticEvent.pattern = -1;
 
+		// Ring full - the event is dropped (counted) rather than stalling the game thread
+		if (!m_ring.Push(hapticEvent))
+			return;
+
+		if (g_hapticsDriver)
 		{
-			std::scoped_lock lock(m_eventsLock);
-			m_events.push_back(std::move(hapticEvent));
+			g_hapticsDriver->NotifyWork();
 		}
 	}
 
@@ -96,52 +218,294 @@ namespace InteractivePipeSmokingVR
 		QueueHapticEvent(strength, strength, 0.022f);
 	}
 
-	void HapticsManager::Loop()
+	void HapticsManager::QueueHapticPattern(HapticPattern pattern)
+	{
+		if (pattern >= HapticPattern::Count)
+			return;
+
+		HapticEvent hapticEvent;
+		hapticEvent.startStrength = 1.0f;
+		hapticEvent.endStrength = 1.0f;
+		hapticEvent.duration = HapticPatternBank::GetSingleton().Get(pattern).durationSeconds;
+		hapticEvent.startTime = 0;
+		hapticEvent.envelope = HapticEnvelope::Linear;
+		hapticEvent.pattern = static_cast<int>(pattern);
+
+		if (!m_ring.Push(hapticEvent))
+			return;
+
+		if (g_hapticsDriver)
+		{
+			g_hapticsDriver->NotifyWork();
+		}
+	}
+
+	bool HapticsManager::RefreshSustained(HapticSustainHandle handle, float strength, double expiry, double currentTime)
+	{
+		SustainedSlot& slot = m_sustained[handle];
+
+		bool live = slot.expiry.load(std::memory_order_relaxed) > currentTime;
+		bool unchanged = live && slot.strength.load(std::memory_order_relaxed) == strength;
+
+		// Strength first - the expiry store publishes it to the driver
+		slot.strength.store(strength, std::memory_order_relaxed);
+		slot.expiry.store(expiry, std::memory_order_seq_cst);
+
+		// Only a channel that was stopped needs the driver's attention
+		if (!live && g_hapticsDriver)
+		{
+			g_hapticsDriver->NotifyWork();
+		}
+		return unchanged;
+	}
+
+	void HapticsManager::CancelSustained(HapticSustainHandle handle)
+	{
+		m_sustained[handle].expiry.store(0.0, std::memory_order_relaxed);
+	}
+
+	bool HapticsManager::HasPendingWork(double currentTime) const
+	{
+		if (!m_ring.IsEmpty())
+			return true;
+
+		for (int i = 0; i < HAPTIC_MAX_SUSTAINED; i++)
+		{
+			if (m_sustained[i].expiry.load(std::memory_order_seq_cst) > currentTime)
+				return true;
+		}
+		return false;
+	}
+
+	bool HapticsManager::Update(double currentTime)
+	{
+		// Start newly submitted events
+		HapticEvent queued;
+		while (m_ring.Pop(queued))
+		{
+			if (m_activeCount >= HAPTIC_MAX_ACTIVE_EVENTS)
+			{
+				m_mixerOverflows++;
+				continue;
+			}
+
+			queued.startTime = currentTime;
+			m_activeEvents[m_activeCount++] = queued;
+			if (m_activeCount > m_activeHighWaterMark)
+			{
+				m_activeHighWaterMark = m_activeCount;
+			}
+		}
+
+		// Live sustained channels join the mix
+		float mixedStrength = 0.0f;
+		bool anySustained = false;
+		for (int s = 0; s < HAPTIC_MAX_SUSTAINED; s++)
+		{
+			if (m_sustained[s].expiry.load(std::memory_order_acquire) > currentTime)
+			{
+				mixedStrength = std::max(mixedStrength, m_sustained[s].strength.load(std::memory_order_relaxed));
+				anySustained = true;
+			}
+		}
+
+		if (m_activeCount == 0 && !anySustained)
+		{
+			m_lastPassTime = -1.0;
+			return false;
+		}
+
+		// Achieved pacing interval for this hand
+		if (m_lastPassTime >= 0.0)
+		{
+			std::scoped_lock lock(m_statsLock);
+			m_passIntervals.Record(static_cast<long long>((currentTime - m_lastPassTime) * 1000000.0));
+		}
+		m_lastPassTime = currentTime;
+
+		// Max-combine every active event, dropping the ones past their duration (swap-remove)
+		const HapticPatternBank& bank = HapticPatternBank::GetSingleton();
+		int i = 0;
+		while (i < m_activeCount)
+		{
+			const HapticEvent& hapticEvent = m_activeEvents[i];
+			double elapsedTime = currentTime - hapticEvent.startTime;
+
+			float t = (hapticEvent.duration == 0) ? 0.0f : static_cast<float>(std::min(1.0, elapsedTime / hapticEvent.duration));
+
+			float strength;
+			if (hapticEvent.pattern >= 0)
+			{
+				strength = HapticPatternBank::Sample(bank.Get(static_cast<HapticPattern>(hapticEvent.pattern)), t);
+			}
+			else if (hapticEvent.duration == 0)
+			{
+				strength = hapticEvent.startStrength;
+			}
+			else
+			{
+				strength = Lerp(hapticEvent.startStrength, hapticEvent.endStrength, t) * EvaluateEnvelope(hapticEvent.envelope, t);
+			}
+
+			mixedStrength = std::max(mixedStrength, strength);
+
+			if (elapsedTime >= hapticEvent.duration)
+			{
+				m_activeEvents[i] = m_activeEvents[--m_activeCount];
+			}
+			else
+			{
+				i++;
+			}
+		}
+
+		TriggerHapticPulse(mixedStrength);
+
+		if (m_activeCount == 0 && !anySustained)
+		{
+			m_lastPassTime = -1.0;
+			return false;
+		}
+		return true;
+	}
+
+	void HapticsManager::DumpStats() const
+	{
+		_MESSAGE("[Haptics] %s hand ring - submitted: %llu, overflows: %llu (capacity %u); mixer - high-water mark: %d/%d, overflows: %llu",
+			m_hand == BSVRInterface::kControllerHand_Left ? "LEFT" : "RIGHT",
+			m_ring.GetPushed(), m_ring.GetOverflows(), HapticEventRing::kCapacity,
+			m_activeHighWaterMark, HAPTIC_MAX_ACTIVE_EVENTS, m_mixerOverflows);
+
+		std::scoped_lock lock(m_statsLock);
+		m_passIntervals.Dump("[Haptics]", m_hand == BSVRInterface::kControllerHand_Left ? "LEFT pulse interval" : "RIGHT pulse interval");
+	}
+
+	// ============================================
+	// HapticsDriver Implementation
+	// ============================================
+
+	HapticsDriver::HapticsDriver(HapticsManager* left, HapticsManager* right)
+		: m_left(left)
+		, m_right(right)
+		, m_running(true)
+		, m_workPending(false)
+		, m_idle(false)
+		, m_wakeups(0)
+		, m_activeMicroseconds(0)
+		, m_startTime(std::chrono::steady_clock::now())
 	{
+		m_thread = std::thread(&HapticsDriver::Loop, this);
+		_MESSAGE("[Haptics] Started haptics driver thread");
+	}
+
+	HapticsDriver::~HapticsDriver()
+	{
+		Shutdown();
+	}
+
+	void HapticsDriver::NotifyWork()
+	{
+		// Driver is pacing - it drains the rings on its next iteration, nothing to do.
+		// Only an idle driver needs the mutex/condition variable, and it holds the mutex just to park.
+		if (!m_idle.load(std::memory_order_seq_cst))
+			return;
+
+		{
+			std::scoped_lock lock(m_lock);
+			m_workPending = true;
+		}
+		m_wakeup.notify_one();
+	}
+
+	void HapticsDriver::Shutdown()
+	{
+		if (!m_running)
+			return;
+
+		{
+			std::scoped_lock lock(m_lock);
+			m_running = false;
+		}
+		m_wakeup.notify_one();
+
+		if (m_thread.joinable())
+		{
+			m_thread.join();
+		}
+		DumpStats();
+		_MESSAGE("[Haptics] Stopped haptics driver thread");
+	}
+
+	double HapticsDriver::GetActiveSeconds() const
+	{
+		return m_activeMicroseconds.load() / 1000000.0;
+	}
+
+	double HapticsDriver::GetWakeupsPerSecond() const
+	{
+		double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+		return elapsed > 0.0 ? m_wakeups.load() / elapsed : 0.0;
+	}
+
+	void HapticsDriver::DumpStats() const
+	{
+		double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+		_MESSAGE("[Haptics] Driver - wakeups: %llu (%.1f/s over %.0fs), active time: %.1fs, pacer: %s",
+			m_wakeups.load(), GetWakeupsPerSecond(), elapsed, GetActiveSeconds(),
+			m_pacer.IsHighResolution() ? "high-resolution waitable timer" : "sleep + spin");
+	}
+
+	void HapticsDriver::Loop()
+	{
+		// TriggerHapticPulse can only be called once every 5ms
+		const auto pulseInterval = std::chrono::milliseconds(5);
+		auto lastPulseTime = std::chrono::steady_clock::now() - pulseInterval;
+
+		std::unique_lock<std::mutex> lock(m_lock);
+
 		while (m_running)
 		{
+			// Publish idle before re-checking the rings: an event pushed while the last burst was
+			// finishing either sees m_idle and notifies, or is seen here
+			m_idle.store(true, std::memory_order_seq_cst);
+			double idleTime = GetTime();
+			if ((m_left && m_left->HasPendingWork(idleTime)) || (m_right && m_right->HasPendingWork(idleTime)))
+			{
+				m_workPending = true;
+			}
+
+			// Idle: block until an event is queued - no periodic wakeups
+			m_wakeup.wait(lock, [this]() { return !m_running || m_workPending; });
+			m_idle.store(false, std::memory_order_seq_cst);
+			if (!m_running)
+				break;
+
+			m_workPending = false;
+			lock.unlock();
+
+			// Respect the pulse limit if the previous burst ended less than 5ms ago
+			auto activeStart = std::chrono::steady_clock::now();
+			m_pacer.SleepUntil(lastPulseTime + pulseInterval);
+
+			// Active: pace both hands until neither has events left
+			while (m_running)
 			{
-				std::scoped_lock lock(m_eventsLock);
-
-				size_t numEvents = m_events.size();
-				if (numEvents > 0)
-				{
-					double currentTime = GetTime();
-
-					// Play the last event that was added
-					HapticEvent& lastEvent = m_events[numEvents - 1];
-
-					if (lastEvent.isNew)
-					{
-						lastEvent.isNew = false;
-						lastEvent.startTime = currentTime;
-					}
-
-					float strength;
-					if (lastEvent.duration == 0)
-					{
-						strength = lastEvent.startStrength;
-					}
-					else
-					{
-						// Lerp from start to end strength over duration
-						double elapsedTime = currentTime - lastEvent.startTime;
-						float t = static_cast<float>(std::min(1.0, elapsedTime / lastEvent.duration));
-						strength = Lerp(lastEvent.startStrength, lastEvent.endStrength, t);
-					}
-
-					TriggerHapticPulse(strength);
-
-					// Cleanup events that are past their duration
-					auto end = std::remove_if(m_events.begin(), m_events.end(),
-						[currentTime](HapticEvent& evnt) { return currentTime - evnt.startTime >= evnt.duration; }
-					);
-					m_events.erase(end, m_events.end());
-				}
+				++m_wakeups;
+				double currentTime = GetTime();
+				bool leftActive = m_left && m_left->Update(currentTime);
+				bool rightActive = m_right && m_right->Update(currentTime);
+				lastPulseTime = std::chrono::steady_clock::now();
+
+				if (!leftActive && !rightActive)
+					break;
+
+				m_pacer.SleepUntil(lastPulseTime + pulseInterval);
 			}
 
-			// TriggerHapticPulse can only be called once every 5ms
-			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			m_activeMicroseconds += static_cast<UInt64>(std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now() - activeStart).count());
+
+			lock.lock();
 		}
 	}
 
@@ -159,11 +523,23 @@ namespace InteractivePipeSmokingVR
 		{
 			g_hapticsRight = new HapticsManager(BSVRInterface::kControllerHand_Right);
 		}
+		if (g_hapticsDriver == nullptr)
+		{
+			// Patterns must be resolved before the driver thread can play them
+			HapticPatternBank::GetSingleton().Load();
+			g_hapticsDriver = new HapticsDriver(g_hapticsLeft, g_hapticsRight);
+		}
 		_MESSAGE("[Haptics] Initialized haptics managers for both hands");
 	}
 
 	void ShutdownHaptics()
 	{
+		// Stop the driver first - it plays the per-hand queues
+		if (g_hapticsDriver != nullptr)
+		{
+			delete g_hapticsDriver;
+			g_hapticsDriver = nullptr;
+		}
 		if (g_hapticsLeft != nullptr)
 		{
 			delete g_hapticsLeft;
@@ -174,18 +550,111 @@ namespace InteractivePipeSmokingVR
 			delete g_hapticsRight;
 			g_hapticsRight = nullptr;
 		}
+		HapticPatternBank::GetSingleton().Unload();
 		_MESSAGE("[Haptics] Shutdown haptics managers");
 	}
 
-	void TriggerHapticFeedback(bool leftHand, bool rightHand, float strength, float duration)
+	void DumpHapticsStats()
+	{
+		if (g_hapticsDriver)
+		{
+			g_hapticsDriver->DumpStats();
+		}
+		if (g_hapticsLeft)
+		{
+			g_hapticsLeft->DumpStats();
+		}
+		if (g_hapticsRight)
+		{
+			g_hapticsRight->DumpStats();
+		}
+		for (int i = 0; i < s_sustainedChannelCount; i++)
+		{
+			const SustainedChannel& channel = s_sustainedChannels[i];
+			_MESSAGE("[Haptics] Sustained '%s' - refreshes: %llu, coalesced: %llu",
+				channel.name, channel.refreshes, channel.coalesced);
+		}
+	}
+
+	HapticSustainHandle RegisterSustainedHaptic(const char* name)
+	{
+		if (s_sustainedChannelCount >= HAPTIC_MAX_SUSTAINED)
+		{
+			_MESSAGE("[Haptics] WARNING: Sustained channel table full (%d) - '%s' not registered", HAPTIC_MAX_SUSTAINED, name ? name : "");
+			return HAPTIC_SUSTAIN_INVALID;
+		}
+
+		HapticSustainHandle handle = s_sustainedChannelCount++;
+		SustainedChannel& channel = s_sustainedChannels[handle];
+		strncpy_s(channel.name, sizeof(channel.name), name ? name : "", _TRUNCATE);
+		channel.refreshes = 0;
+		channel.coalesced = 0;
+
+		_MESSAGE("[Haptics] Registered sustained channel '%s' (handle %d)", channel.name, handle);
+		return handle;
+	}
+
+	void RefreshSustainedHaptic(HapticSustainHandle handle, bool leftHand, bool rightHand, float strength)
+	{
+		if (handle < 0 || handle >= s_sustainedChannelCount)
+			return;
+
+		double now = GetTime();
+		double expiry = now + HAPTIC_SUSTAIN_LEASE_MS / 1000.0;
+
+		bool coalesced = true;
+		if (g_hapticsLeft)
+		{
+			if (leftHand)
+				coalesced = g_hapticsLeft->RefreshSustained(handle, strength, expiry, now) && coalesced;
+			else
+				g_hapticsLeft->CancelSustained(handle);
+		}
+		if (g_hapticsRight)
+		{
+			if (rightHand)
+				coalesced = g_hapticsRight->RefreshSustained(handle, strength, expiry, now) && coalesced;
+			else
+				g_hapticsRight->CancelSustained(handle);
+		}
+
+		SustainedChannel& channel = s_sustainedChannels[handle];
+		channel.refreshes++;
+		if (coalesced)
+		{
+			channel.coalesced++;
+		}
+	}
+
+	void RefreshSustainedHaptic(HapticSustainHandle handle, bool leftHand, bool rightHand, HapticPattern pattern)
+	{
+		RefreshSustainedHaptic(handle, leftHand, rightHand, HapticPatternBank::GetSingleton().GetPeak(pattern));
+	}
+
+	void CancelSustainedHaptic(HapticSustainHandle handle)
+	{
+		if (handle < 0 || handle >= s_sustainedChannelCount)
+			return;
+
+		if (g_hapticsLeft)
+		{
+			g_hapticsLeft->CancelSustained(handle);
+		}
+		if (g_hapticsRight)
+		{
+			g_hapticsRight->CancelSustained(handle);
+		}
+	}
+
+	void TriggerHapticFeedback(bool leftHand, bool rightHand, float strength, float duration, HapticEnvelope envelope)
 	{
 		if (leftHand && g_hapticsLeft)
 		{
-			g_hapticsLeft->QueueHapticEvent(strength, strength, duration);
+			g_hapticsLeft->QueueHapticEvent(strength, strength, duration, envelope);
 		}
 		if (rightHand && g_hapticsRight)
 		{
-			g_hapticsRight->QueueHapticEvent(strength, strength, duration);
+			g_hapticsRight->QueueHapticEvent(strength, strength, duration, envelope);
 		}
 	}
 
@@ -201,6 +670,18 @@ namespace InteractivePipeSmokingVR
 		}
 	}
 
+	void TriggerHapticPattern(bool leftHand, bool rightHand, HapticPattern pattern)
+	{
+		if (leftHand && g_hapticsLeft)
+		{
+			g_hapticsLeft->QueueHapticPattern(pattern);
+		}
+		if (rightHand && g_hapticsRight)
+		{
+			g_hapticsRight->QueueHapticPattern(pattern);
+		}
+	}
+
 	void TriggerHapticFeedbackBothHands(float strength, float duration)
 	{
 		TriggerHapticFeedback(true, true, strength, duration);
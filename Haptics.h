@@ -1,14 +1,61 @@
 #pragma once
 
-#include <vector>
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <condition_variable>
+#include <chrono>
 
 #include "skse64/GameVR.h"
+#include "PrecisionTimer.h"
+#include "HapticPatternBank.h"
+#include "TimingHistogram.h"
 
 namespace InteractivePipeSmokingVR
 {
+	// ============================================
+	// Haptic Envelopes
+	// Shape applied over an event's duration. The strength at phase t (0..1) is
+	// Lerp(startStrength, endStrength, t) * envelope(t); envelopes are sampled once
+	// into lookup tables (HAPTIC_ENVELOPE_SAMPLES points each).
+	// ============================================
+	enum class HapticEnvelope : UInt32
+	{
+		Linear = 0,       // Flat - constant, or a ramp when start != end strength
+		AttackDecay,      // Fast rise then exponential fall-off (confirmation "thunk")
+		PulseTrain,       // HAPTIC_PULSE_TRAIN_PULSES on/off bursts
+		Count
+	};
+
+	constexpr int HAPTIC_ENVELOPE_SAMPLES = 32;
+
+	// AttackDecay: fraction of the duration spent rising
+	constexpr float HAPTIC_ATTACK_FRACTION = 0.15f;
+
+	// PulseTrain: number of bursts and the "on" share of each burst
+	constexpr int HAPTIC_PULSE_TRAIN_PULSES = 2;
+	constexpr float HAPTIC_PULSE_TRAIN_DUTY = 0.6f;
+
+	// Events mixed at once per hand - further events are dropped (counted) until a slot frees
+	constexpr int HAPTIC_MAX_ACTIVE_EVENTS = 16;
+
+	// ============================================
+	// Sustained Haptic Feedback
+	// For feedback that lasts as long as a condition holds (lighting, filling, rolling).
+	// A caller registers a channel once, refreshes it on every update while the condition
+	// holds and cancels it when the condition ends. A refresh only updates the channel's
+	// strength and lease - nothing is queued - and the driver mixes the channel in until
+	// the lease runs out. Game thread only.
+	// ============================================
+	typedef int HapticSustainHandle;
+	constexpr HapticSustainHandle HAPTIC_SUSTAIN_INVALID = -1;
+
+	// Registered sustained channels
+	constexpr int HAPTIC_MAX_SUSTAINED = 8;
+
+	// A channel that is not refreshed for this long stops on its own (covers the slowest tracker update interval)
+	constexpr int HAPTIC_SUSTAIN_LEASE_MS = 250;
+
 	// ============================================
 	// Haptic Event Structure
 	// ============================================
@@ -17,12 +64,52 @@ namespace InteractivePipeSmokingVR
 		float startStrength;
 		float endStrength;
 		double duration;
-		double startTime;
-		bool isNew;
+		double startTime;          // Set by the driver when the event starts playing
+		HapticEnvelope envelope;
+		int pattern;               // HapticPattern played from the bank, -1 = start/end strength + envelope
 	};
 
 	// ============================================
-	// Haptics Manager - handles haptic feedback for one hand
+	// Haptic Event Ring - fixed-capacity lock-free single-producer/single-consumer queue.
+	// The game thread pushes (every TriggerHaptic* call site runs on it), the driver thread pops.
+	// Push never blocks or allocates - when the ring is full the event is dropped and counted.
+	// ============================================
+	class HapticEventRing
+	{
+	public:
+		// Power of two so indices wrap with a mask
+		static constexpr UInt32 kCapacity = 64;
+
+		HapticEventRing();
+
+		// Producer side. Returns false (and counts an overflow) if the ring is full.
+		bool Push(const HapticEvent& hapticEvent);
+
+		// Consumer side. Returns false if the ring is empty.
+		bool Pop(HapticEvent& hapticEvent);
+
+		bool IsEmpty() const;
+
+		// Counters
+		UInt64 GetPushed() const { return m_pushed.load(std::memory_order_relaxed); }
+		UInt64 GetOverflows() const { return m_overflows.load(std::memory_order_relaxed); }
+
+	private:
+		HapticEvent m_slots[kCapacity];
+
+		// Free-running indices, each written by one side only; kept on separate cache lines
+		alignas(64) std::atomic<UInt32> m_head;   // Next slot to write (producer)
+		alignas(64) std::atomic<UInt32> m_tail;   // Next slot to read (consumer)
+
+		std::atomic<UInt64> m_pushed;
+		std::atomic<UInt64> m_overflows;
+	};
+
+	// ============================================
+	// Haptics Manager - haptic event queue and mixer for one hand
+	// (played by the shared HapticsDriver thread). Every active event is
+	// evaluated each pacing interval and the strongest one wins (max-combine),
+	// so overlapping feedback layers instead of overwriting itself.
 	// ============================================
 	class HapticsManager
 	{
@@ -30,24 +117,113 @@ namespace InteractivePipeSmokingVR
 		HapticsManager(BSVRInterface::BSControllerHand hand);
 		~HapticsManager();
 
-		// Queue a haptic event with start/end strength and duration
-		void QueueHapticEvent(float startStrength, float endStrength, float duration);
+		// Queue a haptic event with start/end strength, duration and envelope shape
+		void QueueHapticEvent(float startStrength, float endStrength, float duration,
+			HapticEnvelope envelope = HapticEnvelope::Linear);
 
 		// Queue a simple haptic pulse with given strength (duration = 2 frames)
 		void QueueHapticPulse(float strength);
 
-		// Stop the haptics thread
-		void Shutdown();
+		// Queue a bank pattern (strength curve and duration come from the bank)
+		void QueueHapticPattern(HapticPattern pattern);
+
+		// Mix and play one pacing interval and drop finished events (driver thread).
+		// Returns true while events remain.
+		bool Update(double currentTime);
+
+		// Keep a sustained channel playing at strength until expiry (game thread).
+		// Returns true if the channel was already playing at that strength (refresh coalesced).
+		bool RefreshSustained(HapticSustainHandle handle, float strength, double expiry, double currentTime);
+
+		// Stop a sustained channel (game thread)
+		void CancelSustained(HapticSustainHandle handle);
+
+		// True if events are waiting in the submission ring or a sustained channel is live (any thread)
+		bool HasPendingWork(double currentTime) const;
+
+		// Log submission/overflow counters
+		void DumpStats() const;
 
 	private:
 		void TriggerHapticPulse(float duration);
-		void Loop();
 
 		BSVRInterface::BSControllerHand m_hand;
-		std::vector<HapticEvent> m_events;
-		std::mutex m_eventsLock;
+
+		// Game thread -> driver thread submission
+		HapticEventRing m_ring;
+
+		// Sustained channels - written by the game thread, read by the driver
+		struct SustainedSlot
+		{
+			std::atomic<float> strength;
+			std::atomic<double> expiry;    // GetTime() seconds, 0 = stopped
+		};
+		SustainedSlot m_sustained[HAPTIC_MAX_SUSTAINED];
+
+		// Events being mixed - owned by the driver thread, no lock
+		HapticEvent m_activeEvents[HAPTIC_MAX_ACTIVE_EVENTS];
+		int m_activeCount;
+
+		// Driver-thread counters
+		UInt64 m_mixerOverflows;
+		int m_activeHighWaterMark;
+
+		// Achieved time between pacing passes while this hand is active (GetTime() of the last pass, < 0 = idle)
+		double m_lastPassTime;
+		TimingHistogram m_passIntervals;
+		mutable std::mutex m_statsLock;
+	};
+
+	// ============================================
+	// Haptics Driver - one thread that plays both hands.
+	// Blocks on a condition variable while no events are queued and only
+	// runs the 5 ms pacing loop while at least one hand has work.
+	// Pacing waits on a PrecisionTimer, so passes land on the 5 ms cadence
+	// rather than the ~15 ms granularity of a plain sleep.
+	// ============================================
+	class HapticsDriver
+	{
+	public:
+		HapticsDriver(HapticsManager* left, HapticsManager* right);
+		~HapticsDriver();
+
+		// Wake the thread after an event was queued (game thread).
+		// Lock-free while the driver is already playing; only an idle driver is woken through the mutex.
+		void NotifyWork();
+
+		// Stop and join the thread
+		void Shutdown();
+
+		// Counters
+		UInt64 GetWakeups() const { return m_wakeups; }
+		double GetActiveSeconds() const;
+		double GetWakeupsPerSecond() const;
+
+		// Write the counters to the log
+		void DumpStats() const;
+
+	private:
+		void Loop();
+
+		HapticsManager* m_left;
+		HapticsManager* m_right;
+
+		// Used by the driver thread only
+		PrecisionTimer m_pacer;
+
 		std::thread m_thread;
+		std::mutex m_lock;
+		std::condition_variable m_wakeup;
 		std::atomic<bool> m_running;
+		bool m_workPending;
+
+		// Set while the thread is parked on m_wakeup (or about to be)
+		std::atomic<bool> m_idle;
+
+		// Wakeups = pacing iterations + idle->active transitions; active time in microseconds
+		std::atomic<UInt64> m_wakeups;
+		std::atomic<UInt64> m_activeMicroseconds;
+		std::chrono::steady_clock::time_point m_startTime;
 	};
 
 	// ============================================
@@ -55,6 +231,7 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	extern HapticsManager* g_hapticsLeft;
 	extern HapticsManager* g_hapticsRight;
+	extern HapticsDriver* g_hapticsDriver;
 
 	// ============================================
 	// Helper Functions
@@ -66,15 +243,36 @@ namespace InteractivePipeSmokingVR
 	// Shutdown haptics managers
 	void ShutdownHaptics();
 
+	// Log haptics thread wakeup/active-time, per-hand ring overflow and sustained-channel counters
+	void DumpHapticsStats();
+
+	// Register a sustained feedback channel (name is for the log). Returns HAPTIC_SUSTAIN_INVALID if the table is full.
+	HapticSustainHandle RegisterSustainedHaptic(const char* name);
+
+	// Keep a sustained channel playing on the given hand(s) - call on every update while the condition holds.
+	// A hand that is not selected is stopped.
+	void RefreshSustainedHaptic(HapticSustainHandle handle, bool leftHand, bool rightHand, float strength);
+
+	// Same, at the peak strength of a bank pattern
+	void RefreshSustainedHaptic(HapticSustainHandle handle, bool leftHand, bool rightHand, HapticPattern pattern);
+
+	// Stop a sustained channel on both hands
+	void CancelSustainedHaptic(HapticSustainHandle handle);
+
 	// Trigger a haptic pulse on specified hand(s)
 	// strength: 0.0 to 1.0 (intensity)
 	// duration: in seconds
-	void TriggerHapticFeedback(bool leftHand, bool rightHand, float strength, float duration);
+	// envelope: shape over the duration (default flat)
+	void TriggerHapticFeedback(bool leftHand, bool rightHand, float strength, float duration,
+		HapticEnvelope envelope = HapticEnvelope::Linear);
 
 	// Trigger a short haptic pulse on specified hand(s)
 	// strength: 0.0 to 1.0 (intensity)
 	void TriggerHapticPulse(bool leftHand, bool rightHand, float strength);
 
+	// Play a pattern from the haptic pattern bank on specified hand(s)
+	void TriggerHapticPattern(bool leftHand, bool rightHand, HapticPattern pattern);
+
 	// Trigger haptic feedback on both hands
 	void TriggerHapticFeedbackBothHands(float strength, float duration);
 
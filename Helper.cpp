@@ -1,5 +1,7 @@
 #include "Helper.h"
 #include "Engine.h"
+#include "TaskPool.h"
+#include "ImadEngine.h"
 
 namespace InteractivePipeSmokingVR
 {
@@ -22,14 +24,6 @@ namespace InteractivePipeSmokingVR
 	typedef void(*_DamageActorValue_Native)(VMClassRegistry* registry, UInt32 stackId, Actor* actor, BSFixedString const& valueName, float amount);
 	RelocAddr<_DamageActorValue_Native> DamageActorValue_Native(0x09848B0);
 
-	// ApplyImageSpaceModifier native function address (matching WeaponThrowVR's working implementation)
-	typedef void(*_ApplyImageSpaceModifier_Native)(VMClassRegistry* registry, UInt32 stackId, TESImageSpaceModifier* imad, float strength);
-	RelocAddr<_ApplyImageSpaceModifier_Native> ApplyImageSpaceModifier_Native(0x009C3C70);
-
-	// RemoveImageSpaceModifier native function address (matching WeaponThrowVR's working implementation)
-	typedef void(*_RemoveImageSpaceModifier_Native)(VMClassRegistry* registry, UInt32 stackId, TESImageSpaceModifier* imad);
-	RelocAddr<_RemoveImageSpaceModifier_Native> RemoveImageSpaceModifier_Native(0x009C3CE0);
-
 	std::uintptr_t Write5Call(std::uintptr_t a_src, std::uintptr_t a_dst)
 	{
 		const auto disp = reinterpret_cast<std::int32_t*>(a_src + 1);
@@ -272,7 +266,7 @@ namespace InteractivePipeSmokingVR
 	RelocAddr<_CastSpell> CastSpell(0x009BB6B0);
 
 	// Task to cast spell on main thread
-	class CastSpellOnPlayerTask : public TaskDelegate
+	class CastSpellOnPlayerTask : public PooledTaskDelegate
 	{
 	public:
 		UInt32 m_formId;
@@ -324,97 +318,17 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[CastSpell] Queued spell cast %08X on player", formId);
 	}
 
-	class RemoveImageSpaceModifierTask : public TaskDelegate
-	{
-	public:
-		UInt32 m_formId;
-
-		RemoveImageSpaceModifierTask(UInt32 formId) : m_formId(formId) {}
-
-		virtual void Run() override
-		{
-			TESForm* form = LookupFormByID(m_formId);
-			if (!form) return;
-
-			TESImageSpaceModifier* imad = DYNAMIC_CAST(form, TESForm, TESImageSpaceModifier);
-			if (!imad) return;
-
-			RemoveImageSpaceModifier_Native((*g_skyrimVM)->GetClassRegistry(), 0, imad);
-			_MESSAGE("[IMAD] Removed ImageSpaceModifier %08X", m_formId);
-		}
-
-		virtual void Dispose() override
-		{
-			delete this;
-		}
-	};
-
-	// Task to apply IMAD with specific strength (for fading)
-	class ApplyImageSpaceModifierTask : public TaskDelegate
-	{
-	public:
-		UInt32 m_formId;
-		float m_strength;
-
-		ApplyImageSpaceModifierTask(UInt32 formId, float strength) : m_formId(formId), m_strength(strength) {}
-
-		virtual void Run() override
-		{
-			TESForm* form = LookupFormByID(m_formId);
-			if (!form) return;
-
-			TESImageSpaceModifier* imad = DYNAMIC_CAST(form, TESForm, TESImageSpaceModifier);
-			if (!imad) return;
-
-			ApplyImageSpaceModifier_Native((*g_skyrimVM)->GetClassRegistry(), 0, imad, m_strength);
-		}
-
-		virtual void Dispose() override
-		{
-			delete this;
-		}
-	};
-
+	// ============================================
+	// Image Space Modifiers (animated by the ImadEngine, once per frame)
+	// ============================================
 	void ApplyImageSpaceModifier(UInt32 formId, float strength, float durationSeconds)
 	{
 		if (formId == 0) return;
 
-		TESForm* form = LookupFormByID(formId);
-		if (!form)
-		{
-			_MESSAGE("[IMAD] ERROR: Form %08X not found", formId);
-			return;
-		}
-
-		TESImageSpaceModifier* imad = DYNAMIC_CAST(form, TESForm, TESImageSpaceModifier);
-		if (!imad)
+		float hold = (durationSeconds > 0.0f) ? durationSeconds : IMAD_HOLD_INDEFINITE;
+		if (ImadEngine::GetSingleton().AddCurve(formId, strength, 0.0f, hold, 0.0f))
 		{
-			_MESSAGE("[IMAD] ERROR: Form %08X is not an ImageSpaceModifier", formId);
-			return;
-		}
-
-		// Apply the modifier via task for thread safety
-		if (g_task)
-		{
-			g_task->AddTask(new ApplyImageSpaceModifierTask(formId, strength));
-		}
-		_MESSAGE("[IMAD] Applied ImageSpaceModifier %08X (Strength: %.2f)", formId, strength);
-
-		// If duration is specified, schedule removal
-		if (durationSeconds > 0.0f)
-		{
-			int delayMs = static_cast<int>(durationSeconds * 1000.0f);
-			
-			std::thread([formId, delayMs]() {
-				std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-				
-				if (g_task)
-				{
-					g_task->AddTask(new RemoveImageSpaceModifierTask(formId));
-				}
-			}).detach();
-			
-			_MESSAGE("[IMAD] Scheduled removal in %.1f seconds", durationSeconds);
+			_MESSAGE("[IMAD] Applied ImageSpaceModifier %08X (Strength: %.2f, Duration: %.1fs)", formId, strength, durationSeconds);
 		}
 	}
 
@@ -422,10 +336,7 @@ namespace InteractivePipeSmokingVR
 	{
 		if (formId == 0) return;
 
-		if (g_task)
-		{
-			g_task->AddTask(new RemoveImageSpaceModifierTask(formId));
-		}
+		ImadEngine::GetSingleton().RemoveForm(formId);
 		_MESSAGE("[IMAD] Queued removal of ImageSpaceModifier %08X", formId);
 	}
 
@@ -434,7 +345,7 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	
 	// Task to advance game time on main thread
-	class AdvanceGameTimeTask : public TaskDelegate
+	class AdvanceGameTimeTask : public PooledTaskDelegate
 	{
 	public:
 		float m_hours;
@@ -501,69 +412,15 @@ namespace InteractivePipeSmokingVR
 	{
 		if (formId == 0) return;
 
-		TESForm* form = LookupFormByID(formId);
-		if (!form)
-		{
-			_MESSAGE("[IMAD] ERROR: Form %08X not found", formId);
-			return;
-		}
-
-		TESImageSpaceModifier* imad = DYNAMIC_CAST(form, TESForm, TESImageSpaceModifier);
-		if (!imad)
-		{
-			_MESSAGE("[IMAD] ERROR: Form %08X is not an ImageSpaceModifier", formId);
-			return;
-		}
-
 		_MESSAGE("[IMAD] Applying ImageSpaceModifier %08X with fade (FadeIn: %.1fs, Duration: %.1fs, MaxStrength: %.2f)", 
 			formId, fadeInDuration, activeDuration, maxStrength);
 
-		// Use same fade duration for fade-out
+		// Use same fade duration for fade-out, hold for whatever is left of the active duration
 		float fadeOutDuration = fadeInDuration;
+		float holdTime = activeDuration - fadeInDuration - fadeOutDuration;
+		if (holdTime < 0.0f)
+			holdTime = 0.0f;
 
-		// Start the fade thread
-		std::thread([formId, fadeInDuration, activeDuration, fadeOutDuration, maxStrength]() {
-			const int FADE_STEPS = 10;  // Number of steps for smooth fade
-			const int FADE_STEP_DELAY_MS = static_cast<int>((fadeInDuration * 1000.0f) / FADE_STEPS);
-
-			// === FADE IN ===
-			for (int i = 1; i <= FADE_STEPS; i++)
-			{
-				float strength = (static_cast<float>(i) / static_cast<float>(FADE_STEPS)) * maxStrength;
-				if (g_task)
-				{
-					g_task->AddTask(new ApplyImageSpaceModifierTask(formId, strength));
-				}
-				std::this_thread::sleep_for(std::chrono::milliseconds(FADE_STEP_DELAY_MS));
-			}
-			_MESSAGE("[IMAD] Fade-in complete for %08X (strength: %.2f)", formId, maxStrength);
-
-			// === HOLD AT MAX STRENGTH ===
-			// Calculate hold time: total duration minus both fade times
-			float holdTime = activeDuration - fadeInDuration - fadeOutDuration;
-			if (holdTime > 0.0f)
-			{
-				std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(holdTime * 1000.0f)));
-			}
-
-			// === FADE OUT ===
-			const int FADE_OUT_STEP_DELAY_MS = static_cast<int>((fadeOutDuration * 1000.0f) / FADE_STEPS);
-			for (int i = FADE_STEPS - 1; i >= 0; i--)
-			{
-				float strength = (static_cast<float>(i) / static_cast<float>(FADE_STEPS)) * maxStrength;
-				if (g_task)
-				{
-					g_task->AddTask(new ApplyImageSpaceModifierTask(formId, strength));
-				}
-				std::this_thread::sleep_for(std::chrono::milliseconds(FADE_OUT_STEP_DELAY_MS));
-			}
-			_MESSAGE("[IMAD] Fade-out complete for %08X", formId);
-
-			// === REMOVE ===
-			if (g_task)
-			{
-				g_task->AddTask(new RemoveImageSpaceModifierTask(formId));
-			}
-		}).detach();
+		ImadEngine::GetSingleton().AddCurve(formId, maxStrength, fadeInDuration, holdTime, fadeOutDuration);
 	}
 }
\ No newline at end of file
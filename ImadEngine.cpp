@@ -0,0 +1,342 @@
+#include "ImadEngine.h"
+#include "Helper.h"
+#include <cmath>
+
+namespace InteractivePipeSmokingVR
+{
+	// ApplyImageSpaceModifier native function address (matching WeaponThrowVR's working implementation)
+	typedef void(*_ApplyImageSpaceModifier_Native)(VMClassRegistry* registry, UInt32 stackId, TESImageSpaceModifier* imad, float strength);
+	static RelocAddr<_ApplyImageSpaceModifier_Native> ApplyImageSpaceModifier_Native(0x009C3C70);
+
+	// RemoveImageSpaceModifier native function address (matching WeaponThrowVR's working implementation)
+	typedef void(*_RemoveImageSpaceModifier_Native)(VMClassRegistry* registry, UInt32 stackId, TESImageSpaceModifier* imad);
+	static RelocAddr<_RemoveImageSpaceModifier_Native> RemoveImageSpaceModifier_Native(0x009C3CE0);
+
+	// ============================================
+	// ImadEngine Implementation
+	// ============================================
+
+	ImadEngine& ImadEngine::GetSingleton()
+	{
+		static ImadEngine instance;
+		return instance;
+	}
+
+	ImadEngine::ImadEngine()
+		: m_pushCursor(0)
+		, m_startTime(std::chrono::steady_clock::now())
+		, m_nativeCalls(0)
+		, m_deferredPushes(0)
+		, m_curveHighWaterMark(0)
+	{
+		for (int i = 0; i < IMAD_MAX_CURVES; i++)
+		{
+			m_curves[i] = Curve{};
+			m_curves[i].active = false;
+		}
+
+		for (int i = 0; i < IMAD_MAX_FORMS; i++)
+		{
+			m_forms[i] = FormState{};
+			m_forms[i].formId = 0;
+		}
+	}
+
+	float ImadEngine::GetNowSeconds() const
+	{
+		return std::chrono::duration<float>(std::chrono::steady_clock::now() - m_startTime).count();
+	}
+
+	ImadEngine::FormState* ImadEngine::FindOrAddForm(UInt32 formId)
+	{
+		FormState* freeSlot = nullptr;
+		for (int i = 0; i < IMAD_MAX_FORMS; i++)
+		{
+			if (m_forms[i].formId == formId)
+				return &m_forms[i];
+			if (!freeSlot && m_forms[i].formId == 0)
+				freeSlot = &m_forms[i];
+		}
+
+		if (!freeSlot)
+			return nullptr;
+
+		TESForm* form = LookupFormByID(formId);
+		if (!form)
+		{
+			_MESSAGE("[IMAD] ERROR: Form %08X not found", formId);
+			return nullptr;
+		}
+
+		TESImageSpaceModifier* imad = DYNAMIC_CAST(form, TESForm, TESImageSpaceModifier);
+		if (!imad)
+		{
+			_MESSAGE("[IMAD] ERROR: Form %08X is not an ImageSpaceModifier", formId);
+			return nullptr;
+		}
+
+		freeSlot->formId = formId;
+		freeSlot->imad = imad;
+		freeSlot->target = 0.0f;
+		freeSlot->lastTarget = -1.0f;
+		freeSlot->applied = 0.0f;
+		freeSlot->isApplied = false;
+		freeSlot->curveCount = 0;
+		return freeSlot;
+	}
+
+	bool ImadEngine::AddCurve(UInt32 formId, float peak, float fadeInSeconds, float holdSeconds, float fadeOutSeconds,
+		ImadChannel channel, ImadCurveFinishedCallback onFinished)
+	{
+		if (formId == 0)
+			return false;
+
+		std::scoped_lock lock(m_lock);
+
+		Curve* curve = nullptr;
+		int activeCurves = 0;
+		for (int i = 0; i < IMAD_MAX_CURVES; i++)
+		{
+			if (m_curves[i].active)
+				activeCurves++;
+			else if (!curve)
+				curve = &m_curves[i];
+		}
+
+		if (!curve)
+		{
+			_MESSAGE("[IMAD] WARNING: Curve table full (%d) - dropping IMAD %08X", IMAD_MAX_CURVES, formId);
+			return false;
+		}
+
+		FormState* formState = FindOrAddForm(formId);
+		if (!formState)
+		{
+			_MESSAGE("[IMAD] WARNING: Could not track IMAD %08X (form table full or invalid form)", formId);
+			return false;
+		}
+
+		curve->active = true;
+		curve->formId = formId;
+		curve->channel = channel;
+		curve->startTime = GetNowSeconds();
+		curve->fadeIn = fadeInSeconds > 0.0f ? fadeInSeconds : 0.0f;
+		curve->hold = holdSeconds;
+		curve->fadeOut = fadeOutSeconds > 0.0f ? fadeOutSeconds : 0.0f;
+		curve->peak = peak;
+		curve->onFinished = onFinished;
+		formState->curveCount++;
+
+		activeCurves++;
+		if (activeCurves > m_curveHighWaterMark)
+		{
+			m_curveHighWaterMark = activeCurves;
+		}
+		return true;
+	}
+
+	void ImadEngine::RemoveForm(UInt32 formId)
+	{
+		std::scoped_lock lock(m_lock);
+
+		for (int i = 0; i < IMAD_MAX_CURVES; i++)
+		{
+			if (m_curves[i].active && m_curves[i].formId == formId)
+			{
+				m_curves[i].active = false;
+			}
+		}
+
+		for (int i = 0; i < IMAD_MAX_FORMS; i++)
+		{
+			if (m_forms[i].formId == formId)
+			{
+				m_forms[i].curveCount = 0;
+			}
+		}
+	}
+
+	void ImadEngine::Clear()
+	{
+		std::scoped_lock lock(m_lock);
+
+		for (int i = 0; i < IMAD_MAX_CURVES; i++)
+		{
+			m_curves[i].active = false;
+		}
+
+		for (int i = 0; i < IMAD_MAX_FORMS; i++)
+		{
+			m_forms[i].curveCount = 0;
+		}
+	}
+
+	int ImadEngine::GetActiveCurveCount(ImadChannel channel)
+	{
+		std::scoped_lock lock(m_lock);
+
+		int count = 0;
+		for (int i = 0; i < IMAD_MAX_CURVES; i++)
+		{
+			if (m_curves[i].active && m_curves[i].channel == channel)
+				count++;
+		}
+		return count;
+	}
+
+	float ImadEngine::EvaluateCurve(const Curve& curve, float t, bool& finished)
+	{
+		finished = false;
+
+		if (t < 0.0f)
+			return 0.0f;
+
+		// Fade in
+		if (t < curve.fadeIn)
+			return curve.peak * (t / curve.fadeIn);
+		t -= curve.fadeIn;
+
+		// Hold
+		if (curve.hold < 0.0f || t < curve.hold)
+			return curve.peak;
+		t -= curve.hold;
+
+		// Fade out
+		if (t < curve.fadeOut)
+			return curve.peak * (1.0f - (t / curve.fadeOut));
+
+		finished = true;
+		return 0.0f;
+	}
+
+	void ImadEngine::Update()
+	{
+		// Finished-curve callbacks run after the lock is released
+		struct FinishedCurve
+		{
+			UInt32 formId;
+			ImadChannel channel;
+			ImadCurveFinishedCallback callback;
+		};
+		FinishedCurve finishedCurves[IMAD_MAX_CURVES];
+		int finishedCount = 0;
+
+		{
+			std::scoped_lock lock(m_lock);
+
+			// Quick out when nothing is animating or applied
+			bool anyForm = false;
+			for (int i = 0; i < IMAD_MAX_FORMS; i++)
+			{
+				if (m_forms[i].formId != 0)
+				{
+					anyForm = true;
+					m_forms[i].target = 0.0f;
+				}
+			}
+			if (!anyForm)
+				return;
+
+			// Evaluate every curve and sum per form
+			float now = GetNowSeconds();
+			for (int i = 0; i < IMAD_MAX_CURVES; i++)
+			{
+				Curve& curve = m_curves[i];
+				if (!curve.active)
+					continue;
+
+				bool finished = false;
+				float strength = EvaluateCurve(curve, now - curve.startTime, finished);
+
+				for (int f = 0; f < IMAD_MAX_FORMS; f++)
+				{
+					if (m_forms[f].formId != curve.formId)
+						continue;
+
+					if (finished)
+						m_forms[f].curveCount--;
+					else
+						m_forms[f].target += strength;
+					break;
+				}
+
+				if (finished)
+				{
+					curve.active = false;
+					if (curve.onFinished)
+					{
+						finishedCurves[finishedCount++] = { curve.formId, curve.channel, curve.onFinished };
+					}
+				}
+			}
+
+			// Push changes, round-robin from the cursor, within the per-frame native call budget
+			VMClassRegistry* registry = (*g_skyrimVM) ? (*g_skyrimVM)->GetClassRegistry() : nullptr;
+			int callsThisFrame = 0;
+			for (int n = 0; n < IMAD_MAX_FORMS; n++)
+			{
+				int f = (m_pushCursor + n) % IMAD_MAX_FORMS;
+				FormState& form = m_forms[f];
+				if (form.formId == 0)
+					continue;
+
+				float target = form.target;
+				if (target < 0.0f) target = 0.0f;
+				if (target > 1.0f) target = 1.0f;
+
+				// Push when the change is noticeable, or when the strength has settled (hold) on a value not yet pushed
+				bool settled = (target == form.lastTarget);
+				form.lastTarget = target;
+
+				bool needsRemove = (form.curveCount <= 0);
+				bool needsApply = !needsRemove && target > 0.0f &&
+					(!form.isApplied || std::fabs(target - form.applied) >= IMAD_STRENGTH_EPSILON ||
+					(settled && target != form.applied));
+
+				if (!needsRemove && !needsApply)
+					continue;
+
+				if (callsThisFrame >= IMAD_MAX_NATIVE_CALLS_PER_FRAME || !registry)
+				{
+					m_deferredPushes++;
+					continue;
+				}
+
+				if (needsRemove)
+				{
+					if (form.isApplied)
+					{
+						RemoveImageSpaceModifier_Native(registry, 0, form.imad);
+						callsThisFrame++;
+						m_nativeCalls++;
+						_MESSAGE("[IMAD] Removed ImageSpaceModifier %08X", form.formId);
+					}
+					form.formId = 0;
+					form.imad = nullptr;
+					form.isApplied = false;
+					continue;
+				}
+
+				ApplyImageSpaceModifier_Native(registry, 0, form.imad, target);
+				callsThisFrame++;
+				m_nativeCalls++;
+				form.applied = target;
+				form.isApplied = true;
+			}
+
+			m_pushCursor = (m_pushCursor + 1) % IMAD_MAX_FORMS;
+		}
+
+		for (int i = 0; i < finishedCount; i++)
+		{
+			finishedCurves[i].callback(finishedCurves[i].formId, finishedCurves[i].channel);
+		}
+	}
+
+	void ImadEngine::DumpStats()
+	{
+		std::scoped_lock lock(m_lock);
+		_MESSAGE("[IMAD] Engine - native calls: %llu, deferred pushes: %llu, curve high-water mark: %d/%d",
+			m_nativeCalls, m_deferredPushes, m_curveHighWaterMark, IMAD_MAX_CURVES);
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+
+class TESImageSpaceModifier;
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// IMAD Engine
+	// All image space modifier animation lives here. Each effect is a curve
+	// (fade in -> hold -> fade out) in one fixed array. Once per frame on the game
+	// thread the engine evaluates every curve, sums the strengths per IMAD form
+	// (clamped to 0..1), and pushes one Apply per IMAD whose strength changed -
+	// at most IMAD_MAX_NATIVE_CALLS_PER_FRAME Papyrus native calls per frame.
+	// An IMAD is removed once its last curve has finished.
+	// ============================================
+
+	// Curve slots / distinct IMAD forms in flight at once
+	constexpr int IMAD_MAX_CURVES = 32;
+	constexpr int IMAD_MAX_FORMS = 8;
+
+	// Papyrus native calls (Apply/Remove) allowed per frame - the rest wait for the next frame
+	constexpr int IMAD_MAX_NATIVE_CALLS_PER_FRAME = 4;
+
+	// Strength changes smaller than this are not pushed (fade endpoints always are)
+	constexpr float IMAD_STRENGTH_EPSILON = 0.01f;
+
+	// Hold duration for curves that stay at peak until removed
+	constexpr float IMAD_HOLD_INDEFINITE = -1.0f;
+
+	// Curve channels - lets callers count/remove their own curves
+	enum class ImadChannel : UInt32
+	{
+		Generic = 0,
+		Recreational = 1
+	};
+
+	// Called on the game thread when a curve has fully faded out
+	typedef void(*ImadCurveFinishedCallback)(UInt32 formId, ImadChannel channel);
+
+	class ImadEngine
+	{
+	public:
+		static ImadEngine& GetSingleton();
+
+		// Add a curve: ramps 0 -> peak over fadeIn, holds (IMAD_HOLD_INDEFINITE = until removed), ramps to 0 over fadeOut.
+		// Returns false if the curve or form table is full.
+		bool AddCurve(UInt32 formId, float peak, float fadeInSeconds, float holdSeconds, float fadeOutSeconds,
+			ImadChannel channel = ImadChannel::Generic, ImadCurveFinishedCallback onFinished = nullptr);
+
+		// Drop every curve of an IMAD form (the IMAD is removed on the next frame)
+		void RemoveForm(UInt32 formId);
+
+		// Drop every curve (IMADs currently applied are removed over the next frames)
+		void Clear();
+
+		// Evaluate curves and push strength changes (game thread, once per frame)
+		void Update();
+
+		// Number of curves still running on a channel
+		int GetActiveCurveCount(ImadChannel channel);
+
+		// Counters
+		UInt64 GetNativeCalls() const { return m_nativeCalls; }
+		UInt64 GetDeferredPushes() const { return m_deferredPushes; }
+		int GetCurveHighWaterMark() const { return m_curveHighWaterMark; }
+
+		// Write the counters to the log
+		void DumpStats();
+
+	private:
+		struct Curve
+		{
+			bool active;
+			UInt32 formId;
+			ImadChannel channel;
+			float startTime;
+			float fadeIn;
+			float hold;
+			float fadeOut;
+			float peak;
+			ImadCurveFinishedCallback onFinished;
+		};
+
+		struct FormState
+		{
+			UInt32 formId;                 // 0 = free
+			TESImageSpaceModifier* imad;
+			float target;                  // Summed curve strength this frame
+			float lastTarget;              // Previous frame's target (detects a settled strength)
+			float applied;                 // Last strength pushed to the game
+			bool isApplied;
+			int curveCount;                // Active curves referencing this form
+		};
+
+		ImadEngine();
+		ImadEngine(const ImadEngine&) = delete;
+		ImadEngine& operator=(const ImadEngine&) = delete;
+
+		float GetNowSeconds() const;
+		FormState* FindOrAddForm(UInt32 formId);
+
+		// Strength of a curve at time t (seconds since its start); sets finished once fully faded out
+		static float EvaluateCurve(const Curve& curve, float t, bool& finished);
+
+		Curve m_curves[IMAD_MAX_CURVES];
+		FormState m_forms[IMAD_MAX_FORMS];
+		int m_pushCursor;  // Round-robin start so a busy frame doesn't starve later forms
+
+		std::chrono::steady_clock::time_point m_startTime;
+		std::mutex m_lock;
+
+		UInt64 m_nativeCalls;
+		UInt64 m_deferredPushes;
+		int m_curveHighWaterMark;
+	};
+}
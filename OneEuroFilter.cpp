@@ -0,0 +1,68 @@
+#include "OneEuroFilter.h"
+#include <cmath>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// OneEuroFilter Implementation
+	// ============================================
+
+	OneEuroFilter::OneEuroFilter()
+		: m_minCutoff(0.0f)
+		, m_beta(0.0f)
+		, m_initialized(false)
+		, m_lastTime(0.0)
+		, m_value(0, 0, 0)
+		, m_derivative(0, 0, 0)
+	{
+	}
+
+	void OneEuroFilter::SetParameters(float minCutoff, float beta)
+	{
+		m_minCutoff = minCutoff;
+		m_beta = (beta > 0.0f) ? beta : 0.0f;
+	}
+
+	float OneEuroFilter::Alpha(float cutoff, float dt)
+	{
+		const float kTwoPi = 6.2831853f;
+		float tau = 1.0f / (kTwoPi * cutoff);
+		return 1.0f / (1.0f + tau / dt);
+	}
+
+	NiPoint3 OneEuroFilter::Filter(double time, const NiPoint3& value)
+	{
+		if (m_minCutoff <= 0.0f)
+			return value;
+
+		double elapsed = time - m_lastTime;
+		if (!m_initialized || elapsed > ONE_EURO_MAX_DT_SECONDS)
+		{
+			m_initialized = true;
+			m_lastTime = time;
+			m_value = value;
+			m_derivative = NiPoint3(0, 0, 0);
+			return value;
+		}
+
+		if (elapsed <= 0.0)
+			return m_value;  // Same timestamp - nothing new to filter
+
+		float dt = static_cast<float>(elapsed);
+		m_lastTime = time;
+
+		// Smoothed velocity drives the cutoff
+		float derivativeAlpha = Alpha(ONE_EURO_DERIVATIVE_CUTOFF_HZ, dt);
+		m_derivative.x += ((value.x - m_value.x) / dt - m_derivative.x) * derivativeAlpha;
+		m_derivative.y += ((value.y - m_value.y) / dt - m_derivative.y) * derivativeAlpha;
+		m_derivative.z += ((value.z - m_value.z) / dt - m_derivative.z) * derivativeAlpha;
+
+		float speed = std::sqrt(m_derivative.x * m_derivative.x + m_derivative.y * m_derivative.y + m_derivative.z * m_derivative.z);
+		float alpha = Alpha(m_minCutoff + m_beta * speed, dt);
+
+		m_value.x += (value.x - m_value.x) * alpha;
+		m_value.y += (value.y - m_value.y) * alpha;
+		m_value.z += (value.z - m_value.z) * alpha;
+		return m_value;
+	}
+}
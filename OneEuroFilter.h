@@ -0,0 +1,47 @@
+#pragma once
+
+#include "skse64/NiTypes.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// One Euro Filter
+	// Adaptive low-pass filter for a sampled position (Casiez et al., "1 Euro
+	// Filter"). The cutoff frequency rises with the filtered speed: a hand held
+	// still is smoothed heavily (jitter removed), a hand moving fast is barely
+	// smoothed (little lag). Handles irregular sample intervals.
+	// ============================================
+
+	// Cutoff of the internal speed estimate (Hz)
+	constexpr float ONE_EURO_DERIVATIVE_CUTOFF_HZ = 1.0f;
+
+	// A gap longer than this restarts the filter at the new sample (tracking paused)
+	constexpr double ONE_EURO_MAX_DT_SECONDS = 0.25;
+
+	class OneEuroFilter
+	{
+	public:
+		OneEuroFilter();
+
+		// minCutoff (Hz) = smoothing at rest (<= 0 disables filtering), beta = cutoff increase per unit/s of speed
+		void SetParameters(float minCutoff, float beta);
+
+		// Filter a sample taken at time (seconds)
+		NiPoint3 Filter(double time, const NiPoint3& value);
+
+		// Forget the state - the next sample passes through unfiltered
+		void Reset() { m_initialized = false; }
+
+	private:
+		// Exponential smoothing factor for a cutoff frequency and sample interval
+		static float Alpha(float cutoff, float dt);
+
+		float m_minCutoff;
+		float m_beta;
+
+		bool m_initialized;
+		double m_lastTime;
+		NiPoint3 m_value;        // Last filtered position
+		NiPoint3 m_derivative;   // Last filtered velocity
+	};
+}
@@ -4,6 +4,7 @@
 #include "SmokableIngredients.h"
 #include "Haptics.h"
 #include "VRInputTracker.h"
+#include "ScaleEnforcer.h"
 #include "config.h"
 #include "higgsinterface001.h"
 #include "Helper.h"
@@ -96,30 +97,7 @@ namespace InteractivePipeSmokingVR
 		if (!IsRefrValid(refr))
 			return;
 
-		NiNode* rootNode = refr->GetNiNode();
-		if (!rootNode)
-			return;
-
-		// Set the scale on the root node's local transform
-		rootNode->m_localTransform.scale = targetScale;
-		rootNode->m_worldTransform.scale = targetScale;
-
-		// Recursively set scale on all child nodes
-		for (UInt32 i = 0; i < rootNode->m_children.m_size; ++i)
-		{
-			NiAVObject* child = rootNode->m_children.m_data[i];
-			if (child)
-			{
-				child->m_localTransform.scale = targetScale;
-				child->m_worldTransform.scale = targetScale;
-			}
-		}
-
-		// Force update of world transforms
-		NiAVObject::ControllerUpdateContext ctx;
-		ctx.flags = 0;
-		ctx.delta = 0;
-		rootNode->UpdateWorldData(&ctx);
+		ScaleEnforcer::GetSingleton().Apply(refr, targetScale);
 	}
 
 	// ============================================
@@ -512,6 +490,10 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[PipeCrafting]   -> Item: %s", itemName);
 		_MESSAGE("[PipeCrafting]   -> Material: %s", materialType == CraftingMaterialType::Bone ? "BONE" : "WOOD");
 		_MESSAGE("[PipeCrafting]   -> Velocity: %.2f, Mass: %.2f", separatingVelocity, mass);
+		if (g_vrInputTracker && g_vrInputTracker->IsTracking())
+		{
+			_MESSAGE("[PipeCrafting]   -> Knife hand speed: %.1f units/s", g_vrInputTracker->GetControllerSpeed(isLeft));
+		}
 		_MESSAGE("[PipeCrafting]   -> Hit count: %d / %d", g_craftingHitCount, CRAFTING_HITS_REQUIRED);
 		_MESSAGE("[PipeCrafting]   -> New scale: %.0f%% (shrunk by 20%%)", *currentScale * 100.0f);
 
@@ -816,7 +798,7 @@ namespace InteractivePipeSmokingVR
 				}
 
 				// Trigger haptic feedback on the hand with the Roll of Paper to confirm
-				TriggerHapticFeedback(hasRollOfPaperLeft, hasRollOfPaperRight, 0.5f, 0.3f);
+				TriggerHapticPattern(hasRollOfPaperLeft, hasRollOfPaperRight, HapticPattern::Confirm);
 				_MESSAGE("[SmokeRolling]   -> Haptic feedback triggered on %s hand!", hasRollOfPaperLeft ? "LEFT" : "RIGHT");
 
 				// Clear smokable tracking
@@ -968,28 +950,29 @@ namespace InteractivePipeSmokingVR
 	}
 
 	// ============================================
-	// Update held crafting item scale (called every frame via HIGGS callback)
+	// Update held crafting item scale (called every frame via HIGGS callback,
+	// only re-applied when HIGGS overwrote it)
 	// ============================================
 	void UpdateHeldCraftingItemScale()
 	{
 		// Update pipe crafting items
 		if (g_heldCraftingItemLeft && IsRefrValid(g_heldCraftingItemLeft))
 		{
-			ShrinkCraftingItem(g_heldCraftingItemLeft, s_craftingItemScaleLeft);
+			ScaleEnforcer::GetSingleton().Enforce(g_heldCraftingItemLeft, s_craftingItemScaleLeft);
 		}
 		if (g_heldCraftingItemRight && IsRefrValid(g_heldCraftingItemRight))
 		{
-			ShrinkCraftingItem(g_heldCraftingItemRight, s_craftingItemScaleRight);
+			ScaleEnforcer::GetSingleton().Enforce(g_heldCraftingItemRight, s_craftingItemScaleRight);
 		}
 
 		// Update roll of paper items (smoke rolling)
 		if (g_heldRollOfPaperLeft && IsRefrValid(g_heldRollOfPaperLeft))
 		{
-			ShrinkCraftingItem(g_heldRollOfPaperLeft, ROLL_OF_PAPER_SCALE);
+			ScaleEnforcer::GetSingleton().Enforce(g_heldRollOfPaperLeft, ROLL_OF_PAPER_SCALE);
 		}
 		if (g_heldRollOfPaperRight && IsRefrValid(g_heldRollOfPaperRight))
 		{
-			ShrinkCraftingItem(g_heldRollOfPaperRight, ROLL_OF_PAPER_SCALE);
+			ScaleEnforcer::GetSingleton().Enforce(g_heldRollOfPaperRight, ROLL_OF_PAPER_SCALE);
 		}
 
 		// Check smoke rolling condition
@@ -1002,6 +985,9 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	void CheckSmokeRollingCondition()
 	{
+		// "Ready to roll" feedback channel, refreshed while the condition holds
+		static const HapticSustainHandle rollingHaptic = RegisterSustainedHaptic("SmokeRolling");
+
 		// Check if we have a roll of paper in either hand
 		bool hasRollOfPaperLeft = (g_heldRollOfPaperLeft != nullptr);
 		bool hasRollOfPaperRight = (g_heldRollOfPaperRight != nullptr);
@@ -1009,6 +995,7 @@ namespace InteractivePipeSmokingVR
 
 		if (!hasRollOfPaper)
 		{
+			CancelSustainedHaptic(rollingHaptic);
 			g_smokeRollingConditionLogged = false;
 			return;
 		}
@@ -1022,6 +1009,7 @@ namespace InteractivePipeSmokingVR
 
 		if (!validCombination)
 		{
+			CancelSustainedHaptic(rollingHaptic);
 			g_smokeRollingConditionLogged = false;
 			return;
 		}
@@ -1031,12 +1019,13 @@ namespace InteractivePipeSmokingVR
 		
 		if (!controllersNearForRolling)
 		{
+			CancelSustainedHaptic(rollingHaptic);
 			g_smokeRollingConditionLogged = false;
 			return;
 		}
 
 		// All conditions met! Trigger weak haptic pulse on both hands
-		TriggerHapticPulse(true, true, 0.08f);  // Weak continuous feedback on both hands
+		RefreshSustainedHaptic(rollingHaptic, true, true, HapticPattern::Sustain);  // Weak continuous feedback on both hands
 
 		if (!g_smokeRollingConditionLogged)
 		{
@@ -0,0 +1,113 @@
+#include "PoseHistory.h"
+#include <cmath>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// PoseHistory Implementation
+	// ============================================
+
+	PoseHistory::PoseHistory()
+		: m_head(POSE_HISTORY_CAPACITY - 1)
+		, m_count(0)
+	{
+	}
+
+	void PoseHistory::Clear()
+	{
+		m_head = POSE_HISTORY_CAPACITY - 1;
+		m_count = 0;
+	}
+
+	void PoseHistory::Push(double time, const NiPoint3& position, const NiPoint3& up)
+	{
+		NiPoint3 velocity(0, 0, 0);
+		NiPoint3 acceleration(0, 0, 0);
+
+		if (m_count > 0)
+		{
+			const PoseSample& previous = m_samples[m_head];
+			double dt = time - previous.time;
+
+			if (dt < POSE_HISTORY_MIN_DT_SECONDS)
+			{
+				// Same frame sampled twice - keep the estimates, take the newer pose
+				velocity = previous.velocity;
+				acceleration = previous.acceleration;
+			}
+			else if (dt <= POSE_HISTORY_MAX_DT_SECONDS)
+			{
+				float invDt = static_cast<float>(1.0 / dt);
+
+				// Blend factor of an exponential moving average with the smoothing time constant
+				float alpha = static_cast<float>(1.0 - std::exp(-dt / POSE_HISTORY_SMOOTHING_SECONDS));
+
+				NiPoint3 rawVelocity;
+				rawVelocity.x = (position.x - previous.position.x) * invDt;
+				rawVelocity.y = (position.y - previous.position.y) * invDt;
+				rawVelocity.z = (position.z - previous.position.z) * invDt;
+
+				velocity.x = previous.velocity.x + (rawVelocity.x - previous.velocity.x) * alpha;
+				velocity.y = previous.velocity.y + (rawVelocity.y - previous.velocity.y) * alpha;
+				velocity.z = previous.velocity.z + (rawVelocity.z - previous.velocity.z) * alpha;
+
+				NiPoint3 rawAcceleration;
+				rawAcceleration.x = (velocity.x - previous.velocity.x) * invDt;
+				rawAcceleration.y = (velocity.y - previous.velocity.y) * invDt;
+				rawAcceleration.z = (velocity.z - previous.velocity.z) * invDt;
+
+				acceleration.x = previous.acceleration.x + (rawAcceleration.x - previous.acceleration.x) * alpha;
+				acceleration.y = previous.acceleration.y + (rawAcceleration.y - previous.acceleration.y) * alpha;
+				acceleration.z = previous.acceleration.z + (rawAcceleration.z - previous.acceleration.z) * alpha;
+			}
+			// else: long gap - restart from rest
+		}
+
+		m_head = (m_head + 1) % POSE_HISTORY_CAPACITY;
+		if (m_count < POSE_HISTORY_CAPACITY)
+			m_count++;
+
+		PoseSample& sample = m_samples[m_head];
+		sample.time = time;
+		sample.position = position;
+		sample.up = up;
+		sample.velocity = velocity;
+		sample.acceleration = acceleration;
+	}
+
+	const PoseSample& PoseHistory::GetSample(int ago) const
+	{
+		int index = (m_head - ago) % POSE_HISTORY_CAPACITY;
+		if (index < 0)
+			index += POSE_HISTORY_CAPACITY;
+		return m_samples[index];
+	}
+
+	NiPoint3 PoseHistory::GetVelocity() const
+	{
+		return m_count > 0 ? m_samples[m_head].velocity : NiPoint3(0, 0, 0);
+	}
+
+	NiPoint3 PoseHistory::GetAcceleration() const
+	{
+		return m_count > 0 ? m_samples[m_head].acceleration : NiPoint3(0, 0, 0);
+	}
+
+	float PoseHistory::GetSpeed() const
+	{
+		NiPoint3 v = GetVelocity();
+		return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+	}
+
+	void PoseHistory::Dump(const char* label) const
+	{
+		_MESSAGE("[PoseHistory] %s: %d samples (time, pos x/y/z, up x/y/z, vel x/y/z, acc x/y/z)", label, m_count);
+		for (int ago = m_count - 1; ago >= 0; ago--)
+		{
+			const PoseSample& s = GetSample(ago);
+			_MESSAGE("[PoseHistory] %s,%.4f,%.2f,%.2f,%.2f,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f", label, s.time,
+				s.position.x, s.position.y, s.position.z, s.up.x, s.up.y, s.up.z,
+				s.velocity.x, s.velocity.y, s.velocity.z, s.acceleration.x, s.acceleration.y, s.acceleration.z);
+		}
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "skse64/NiTypes.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Pose History
+	// Fixed-size ring of timestamped poses for one tracked point (a controller or
+	// the HMD). Velocity and acceleration are estimated incrementally when a sample
+	// is pushed - a finite difference against the previous sample, smoothed with an
+	// exponential moving average - so each sample costs O(1) and readers never
+	// re-derive motion from the raw positions. The ring can be dumped to the log
+	// for offline analysis.
+	// Written and read on the tracker's update thread only.
+	// ============================================
+
+	// Samples kept per tracked point (~0.7s at 90 fps, ~6s at the 10 Hz timer rate)
+	constexpr int POSE_HISTORY_CAPACITY = 64;
+
+	// Smoothing time constant of the velocity / acceleration estimates
+	constexpr double POSE_HISTORY_SMOOTHING_SECONDS = 0.03;
+
+	// Samples closer together than this don't update the derivatives (duplicate frame)
+	constexpr double POSE_HISTORY_MIN_DT_SECONDS = 0.0005;
+
+	// A gap longer than this (tracking paused, menu open) restarts the estimates from rest
+	constexpr double POSE_HISTORY_MAX_DT_SECONDS = 0.25;
+
+	struct PoseSample
+	{
+		double time;             // Seconds (tracker clock)
+		NiPoint3 position;       // World position
+		NiPoint3 up;             // World up vector of the tracked node
+		NiPoint3 velocity;       // Units per second (smoothed)
+		NiPoint3 acceleration;   // Units per second squared (smoothed)
+	};
+
+	class PoseHistory
+	{
+	public:
+		PoseHistory();
+
+		// Record a pose and update the velocity/acceleration estimates
+		void Push(double time, const NiPoint3& position, const NiPoint3& up);
+
+		// Forget every sample (tracking restarted)
+		void Clear();
+
+		int GetCount() const { return m_count; }
+		bool IsEmpty() const { return m_count == 0; }
+
+		// Sample 'ago' pushes back (0 = latest). ago must be < GetCount().
+		const PoseSample& GetSample(int ago) const;
+		const PoseSample& GetLatest() const { return GetSample(0); }
+
+		// Current estimates (zero while empty)
+		NiPoint3 GetVelocity() const;
+		NiPoint3 GetAcceleration() const;
+		float GetSpeed() const;
+
+		// Write every sample, oldest first, to the log as CSV rows
+		void Dump(const char* label) const;
+
+	private:
+		PoseSample m_samples[POSE_HISTORY_CAPACITY];
+		int m_head;    // Index of the latest sample
+		int m_count;
+	};
+}
@@ -0,0 +1,68 @@
+#include "PrecisionTimer.h"
+#include <thread>
+#include <Windows.h>
+
+// Not defined by older Windows SDKs
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// PrecisionTimer Implementation
+	// ============================================
+
+	PrecisionTimer::PrecisionTimer()
+		: m_timer(nullptr)
+	{
+		m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		if (!m_timer)
+		{
+			_MESSAGE("[PrecisionTimer] High-resolution waitable timer unavailable (error %lu) - using sleep + spin", GetLastError());
+		}
+	}
+
+	PrecisionTimer::~PrecisionTimer()
+	{
+		if (m_timer)
+		{
+			CloseHandle(m_timer);
+			m_timer = nullptr;
+		}
+	}
+
+	void PrecisionTimer::SleepUntil(std::chrono::steady_clock::time_point deadline)
+	{
+		const auto spinMargin = std::chrono::microseconds(m_timer ? PRECISION_TIMER_SPIN_US : PRECISION_TIMER_FALLBACK_SPIN_US);
+
+		auto remaining = deadline - std::chrono::steady_clock::now();
+		if (remaining > spinMargin)
+		{
+			if (m_timer)
+			{
+				// Relative due time, in 100 ns units (negative = relative)
+				LARGE_INTEGER dueTime;
+				dueTime.QuadPart = -static_cast<LONGLONG>(
+					std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - spinMargin).count() / 100);
+
+				if (SetWaitableTimer(m_timer, &dueTime, 0, nullptr, nullptr, FALSE))
+				{
+					WaitForSingleObject(m_timer, INFINITE);
+				}
+			}
+			else
+			{
+				while (deadline - std::chrono::steady_clock::now() > spinMargin)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+		}
+
+		while (std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Precision Timer
+	// Sleeps a thread until a steady_clock deadline with sub-millisecond accuracy.
+	// The bulk of the wait is a high-resolution waitable timer (Windows 10 1803+);
+	// without one it falls back to 1 ms sleeps (only as fine as the system timer
+	// resolution) and spins a longer tail. The last stretch is spun with yields,
+	// so the wake-up lands on the deadline instead of one scheduler quantum after it.
+	// One instance per thread.
+	// ============================================
+
+	// Remaining time that is spun instead of slept (waitable timer / sleep fallback)
+	constexpr int PRECISION_TIMER_SPIN_US = 300;
+	constexpr int PRECISION_TIMER_FALLBACK_SPIN_US = 2000;
+
+	class PrecisionTimer
+	{
+	public:
+		PrecisionTimer();
+		~PrecisionTimer();
+
+		// Block until deadline (returns immediately if it has passed)
+		void SleepUntil(std::chrono::steady_clock::time_point deadline);
+
+		// True if the high-resolution waitable timer is in use
+		bool IsHighResolution() const { return m_timer != nullptr; }
+
+	private:
+		PrecisionTimer(const PrecisionTimer&) = delete;
+		PrecisionTimer& operator=(const PrecisionTimer&) = delete;
+
+		void* m_timer;  // Waitable timer HANDLE, nullptr = sleep fallback
+	};
+}
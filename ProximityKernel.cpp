@@ -0,0 +1,144 @@
+#include "ProximityKernel.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define PROXIMITY_KERNEL_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace InteractivePipeSmokingVR
+{
+	// Pair each zone lane is tested against (padding lanes point at a padding pair)
+	static const UInt32 kZonePair[PROXIMITY_ZONE_LANES] = {
+		static_cast<UInt32>(ProximityPair::LeftToRight),   // ControllersTouch
+		static_cast<UInt32>(ProximityPair::LeftToRight),   // PipeFilling
+		static_cast<UInt32>(ProximityPair::LeftToRight),   // SmokeRolling
+		static_cast<UInt32>(ProximityPair::LeftToRight),   // PipeLighting
+		static_cast<UInt32>(ProximityPair::LeftToRight),   // RolledSmokeLighting
+		static_cast<UInt32>(ProximityPair::Count),         // Padding
+		static_cast<UInt32>(ProximityPair::Count),         // Padding
+		static_cast<UInt32>(ProximityPair::Count)          // Padding
+	};
+
+	static_assert(static_cast<int>(ProximityZone::Count) < PROXIMITY_ZONE_LANES, "zone lanes");
+	static_assert(static_cast<int>(ProximityPair::Count) < PROXIMITY_PAIR_LANES, "pair lanes");
+
+	// ============================================
+	// ProximityKernel Implementation
+	// ============================================
+
+	ProximityKernel::ProximityKernel()
+		: m_mask(0)
+	{
+		for (int i = 0; i < PROXIMITY_PAIR_LANES; i++)
+		{
+			m_points.ax[i] = m_points.ay[i] = m_points.az[i] = 0.0f;
+			m_points.bx[i] = m_points.by[i] = m_points.bz[i] = 0.0f;
+			m_distanceSquared[i] = 0.0f;
+		}
+		SetRadii(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+	}
+
+	void ProximityKernel::SetRadii(float controllerTouchRadius, float pipeFillingRadius, float smokeRollingRadius,
+		float pipeLightingRadius, float rolledSmokeLightingRadius, float exitBand)
+	{
+		const float radii[PROXIMITY_ZONE_LANES] = {
+			controllerTouchRadius,
+			pipeFillingRadius,
+			smokeRollingRadius,
+			pipeLightingRadius,
+			rolledSmokeLightingRadius,
+			-1.0f,
+			-1.0f,
+			-1.0f
+		};
+
+		if (exitBand < 0.0f)
+			exitBand = 0.0f;
+
+		for (int i = 0; i < PROXIMITY_ZONE_LANES; i++)
+		{
+			// A negative radius disables the zone (distance squared is never negative)
+			bool disabled = (radii[i] < 0.0f);
+			float exitRadius = radii[i] + exitBand;
+			m_enterRadiiSquared[i] = disabled ? -1.0f : radii[i] * radii[i];
+			m_exitRadiiSquared[i] = disabled ? -1.0f : exitRadius * exitRadius;
+		}
+	}
+
+	void ProximityKernel::SetPoints(const NiPoint3& leftController, const NiPoint3& rightController)
+	{
+		const NiPoint3* from[PROXIMITY_PAIR_LANES] = { &leftController, &leftController, &leftController, &leftController };
+		const NiPoint3* to[PROXIMITY_PAIR_LANES] = { &rightController, &leftController, &leftController, &leftController };
+
+		for (int i = 0; i < PROXIMITY_PAIR_LANES; i++)
+		{
+			m_points.ax[i] = from[i]->x;
+			m_points.ay[i] = from[i]->y;
+			m_points.az[i] = from[i]->z;
+			m_points.bx[i] = to[i]->x;
+			m_points.by[i] = to[i]->y;
+			m_points.bz[i] = to[i]->z;
+		}
+	}
+
+	UInt32 ProximityKernel::Evaluate()
+	{
+#ifdef PROXIMITY_KERNEL_SSE
+		m_mask = EvaluateSSE(m_points, m_enterRadiiSquared, m_exitRadiiSquared, m_mask, m_distanceSquared);
+#else
+		m_mask = EvaluateScalar(m_points, m_enterRadiiSquared, m_exitRadiiSquared, m_mask, m_distanceSquared);
+#endif
+		return m_mask;
+	}
+
+	UInt32 ProximityKernel::EvaluateScalar(const ProximityPoints& points, const float* enterRadiiSquared,
+		const float* exitRadiiSquared, UInt32 previousMask, float* distanceSquared)
+	{
+		for (int p = 0; p < PROXIMITY_PAIR_LANES; p++)
+		{
+			float dx = points.ax[p] - points.bx[p];
+			float dy = points.ay[p] - points.by[p];
+			float dz = points.az[p] - points.bz[p];
+			distanceSquared[p] = dx * dx + dy * dy + dz * dz;
+		}
+
+		UInt32 mask = 0;
+		for (int z = 0; z < PROXIMITY_ZONE_LANES; z++)
+		{
+			UInt32 bit = 1u << z;
+			const float* radiiSquared = (previousMask & bit) ? exitRadiiSquared : enterRadiiSquared;
+			if (distanceSquared[kZonePair[z]] <= radiiSquared[z])
+				mask |= bit;
+		}
+		return mask;
+	}
+
+	UInt32 ProximityKernel::EvaluateSSE(const ProximityPoints& points, const float* enterRadiiSquared,
+		const float* exitRadiiSquared, UInt32 previousMask, float* distanceSquared)
+	{
+#ifdef PROXIMITY_KERNEL_SSE
+		// All pairs at once: d = a - b, distance squared = dx*dx + dy*dy + dz*dz
+		__m128 dx = _mm_sub_ps(_mm_load_ps(points.ax), _mm_load_ps(points.bx));
+		__m128 dy = _mm_sub_ps(_mm_load_ps(points.ay), _mm_load_ps(points.by));
+		__m128 dz = _mm_sub_ps(_mm_load_ps(points.az), _mm_load_ps(points.bz));
+		__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		_mm_store_ps(distanceSquared, dist);
+
+		// Spread the pair distances over the zone lanes (layout of kZonePair):
+		//   zones 0-3: LeftToRight, LeftToRight, LeftToRight, LeftToRight
+		//   zones 4-7: LeftToRight, padding, padding, padding
+		__m128 zonesLow = _mm_shuffle_ps(dist, dist, _MM_SHUFFLE(0, 0, 0, 0));
+		__m128 zonesHigh = _mm_shuffle_ps(dist, dist, _MM_SHUFFLE(1, 1, 1, 0));
+
+		UInt32 inEnter = static_cast<UInt32>(_mm_movemask_ps(_mm_cmple_ps(zonesLow, _mm_load_ps(enterRadiiSquared))) |
+			(_mm_movemask_ps(_mm_cmple_ps(zonesHigh, _mm_load_ps(enterRadiiSquared + 4))) << 4));
+		UInt32 inExit = static_cast<UInt32>(_mm_movemask_ps(_mm_cmple_ps(zonesLow, _mm_load_ps(exitRadiiSquared))) |
+			(_mm_movemask_ps(_mm_cmple_ps(zonesHigh, _mm_load_ps(exitRadiiSquared + 4))) << 4));
+
+		// Zones already entered stay in until they leave the exit radius
+		return (inEnter & ~previousMask) | (inExit & previousMask);
+#else
+		return EvaluateScalar(points, enterRadiiSquared, exitRadiiSquared, previousMask, distanceSquared);
+#endif
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "skse64/NiTypes.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Proximity Kernel
+	// Evaluates every hand-to-hand interaction radius in one pass. The point pairs
+	// (currently only left controller -> right controller) are stored as a
+	// structure of arrays, one SSE lane per pair. Their squared distances are
+	// compared against a precomputed table of squared radii, one lane per zone, so
+	// the result is a bitmask of zone memberships with no square roots. The face
+	// zone is not tested here - it is the Lips zone of the ZoneRegistry. An SSE path is
+	// used where available, with a scalar fallback producing identical results.
+	// Every zone has an enter radius and a larger exit radius: a point outside has
+	// to come within the enter radius, a point inside has to leave the exit radius,
+	// so jitter on the boundary does not toggle the membership.
+	// ============================================
+
+	// Point pairs, one lane each (lanes 1-3 are padding)
+	enum class ProximityPair : UInt32
+	{
+		LeftToRight = 0,
+		Count
+	};
+
+	// Zones, one bit each in the membership mask
+	enum class ProximityZone : UInt32
+	{
+		ControllersTouch = 0,  // LeftToRight within the controller touch radius
+		PipeFilling,           // LeftToRight within the pipe filling radius
+		SmokeRolling,          // LeftToRight within the smoke rolling radius
+		PipeLighting,          // LeftToRight within the pipe lighting radius
+		RolledSmokeLighting,   // LeftToRight within the rolled smoke lighting radius
+		Count
+	};
+
+	inline UInt32 ProximityBit(ProximityZone zone)
+	{
+		return 1u << static_cast<UInt32>(zone);
+	}
+
+	constexpr int PROXIMITY_PAIR_LANES = 4;
+	constexpr int PROXIMITY_ZONE_LANES = 8;
+
+	// Pair endpoints in SoA layout: pair p runs from (ax, ay, az)[p] to (bx, by, bz)[p]
+	struct alignas(16) ProximityPoints
+	{
+		float ax[PROXIMITY_PAIR_LANES];
+		float ay[PROXIMITY_PAIR_LANES];
+		float az[PROXIMITY_PAIR_LANES];
+		float bx[PROXIMITY_PAIR_LANES];
+		float by[PROXIMITY_PAIR_LANES];
+		float bz[PROXIMITY_PAIR_LANES];
+	};
+
+	class ProximityKernel
+	{
+	public:
+		ProximityKernel();
+
+		// Rebuild the squared radius tables (after the config was loaded); exit radius = enter radius + exitBand
+		void SetRadii(float controllerTouchRadius, float pipeFillingRadius, float smokeRollingRadius, float pipeLightingRadius, float rolledSmokeLightingRadius, float exitBand);
+
+		// Forget the memberships - the next Evaluate tests every zone against its enter radius
+		void Reset() { m_mask = 0; }
+
+		// Store the tracked positions into the pair lanes
+		void SetPoints(const NiPoint3& leftController, const NiPoint3& rightController);
+
+		// Compute the squared pair distances and the zone membership mask (ProximityBit per zone),
+		// using the exit radius for zones in the previous mask
+		UInt32 Evaluate();
+
+		UInt32 GetMask() const { return m_mask; }
+		bool IsInZone(ProximityZone zone) const { return (m_mask & ProximityBit(zone)) != 0; }
+
+		// Squared distance of a pair from the last Evaluate
+		float GetDistanceSquared(ProximityPair pair) const { return m_distanceSquared[static_cast<UInt32>(pair)]; }
+
+		// Reference implementation, also used where SSE is unavailable
+		static UInt32 EvaluateScalar(const ProximityPoints& points, const float* enterRadiiSquared,
+			const float* exitRadiiSquared, UInt32 previousMask, float* distanceSquared);
+
+		// SSE implementation (same results as EvaluateScalar)
+		static UInt32 EvaluateSSE(const ProximityPoints& points, const float* enterRadiiSquared,
+			const float* exitRadiiSquared, UInt32 previousMask, float* distanceSquared);
+
+	private:
+		ProximityPoints m_points;
+
+		// Squared radii per zone lane; padding lanes are negative so they never match
+		alignas(16) float m_enterRadiiSquared[PROXIMITY_ZONE_LANES];
+		alignas(16) float m_exitRadiiSquared[PROXIMITY_ZONE_LANES];
+
+		alignas(16) float m_distanceSquared[PROXIMITY_PAIR_LANES];
+		UInt32 m_mask;
+	};
+}
@@ -0,0 +1,141 @@
+#include "ScaleEnforcer.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// ScaleEnforcer Implementation
+	// ============================================
+
+	ScaleEnforcer& ScaleEnforcer::GetSingleton()
+	{
+		static ScaleEnforcer instance;
+		return instance;
+	}
+
+	ScaleEnforcer::ScaleEnforcer()
+		: m_stamp(0)
+		, m_applies(0)
+		, m_checks(0)
+		, m_reapplies(0)
+		, m_overwrites(0)
+		, m_reattaches(0)
+	{
+		Clear();
+	}
+
+	void ScaleEnforcer::WriteScale(NiNode* rootNode, float targetScale)
+	{
+		// Set the scale on the root node's local and world transform
+		rootNode->m_localTransform.scale = targetScale;
+		rootNode->m_worldTransform.scale = targetScale;
+
+		// Set scale on all child nodes as well
+		for (UInt32 i = 0; i < rootNode->m_children.m_size; ++i)
+		{
+			NiAVObject* child = rootNode->m_children.m_data[i];
+			if (child)
+			{
+				child->m_localTransform.scale = targetScale;
+				child->m_worldTransform.scale = targetScale;
+			}
+		}
+
+		// Force update of world transforms
+		NiAVObject::ControllerUpdateContext ctx;
+		ctx.flags = 0;
+		ctx.delta = 0;
+		rootNode->UpdateWorldData(&ctx);
+	}
+
+	bool ScaleEnforcer::IsScaleOverwritten(NiNode* rootNode, float targetScale)
+	{
+		// Exact compares - the values are only ever the ones written by WriteScale
+		if (rootNode->m_localTransform.scale != targetScale || rootNode->m_worldTransform.scale != targetScale)
+			return true;
+
+		for (UInt32 i = 0; i < rootNode->m_children.m_size; ++i)
+		{
+			NiAVObject* child = rootNode->m_children.m_data[i];
+			if (child && child->m_localTransform.scale != targetScale)
+				return true;
+		}
+		return false;
+	}
+
+	ScaleEnforcer::Entry& ScaleEnforcer::GetEntry(TESObjectREFR* refr)
+	{
+		Entry* oldest = &m_entries[0];
+		for (Entry& entry : m_entries)
+		{
+			if (entry.refr == refr)
+				return entry;
+			if (entry.lastUse < oldest->lastUse)
+				oldest = &entry;
+		}
+
+		oldest->refr = refr;
+		oldest->root = nullptr;
+		oldest->scale = 0.0f;
+		return *oldest;
+	}
+
+	void ScaleEnforcer::Apply(TESObjectREFR* refr, float targetScale)
+	{
+		NiNode* rootNode = refr ? refr->GetNiNode() : nullptr;
+		if (!rootNode)
+			return;
+
+		WriteScale(rootNode, targetScale);
+		m_applies++;
+
+		Entry& entry = GetEntry(refr);
+		entry.root = rootNode;
+		entry.scale = targetScale;
+		entry.lastUse = ++m_stamp;
+	}
+
+	bool ScaleEnforcer::Enforce(TESObjectREFR* refr, float targetScale)
+	{
+		NiNode* rootNode = refr ? refr->GetNiNode() : nullptr;
+		if (!rootNode)
+			return false;
+
+		m_checks++;
+
+		Entry& entry = GetEntry(refr);
+		entry.lastUse = ++m_stamp;
+
+		bool reattached = entry.root != rootNode;
+		if (!reattached && entry.scale == targetScale && !IsScaleOverwritten(rootNode, targetScale))
+			return false;
+
+		if (reattached)
+			m_reattaches++;
+		else if (entry.scale == targetScale)
+			m_overwrites++;
+
+		WriteScale(rootNode, targetScale);
+		m_reapplies++;
+
+		entry.root = rootNode;
+		entry.scale = targetScale;
+		return true;
+	}
+
+	void ScaleEnforcer::Clear()
+	{
+		for (Entry& entry : m_entries)
+		{
+			entry.refr = nullptr;
+			entry.root = nullptr;
+			entry.scale = 0.0f;
+			entry.lastUse = 0;
+		}
+	}
+
+	void ScaleEnforcer::DumpStats()
+	{
+		_MESSAGE("[ScaleEnforcer] applies: %llu, per-frame checks: %llu, re-applied: %llu (overwritten: %llu, new 3D: %llu)",
+			m_applies, m_checks, m_reapplies, m_overwrites, m_reattaches);
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "skse64/GameReferences.h"
+#include "skse64/NiNodes.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Scale Enforcer
+	// Keeps held items (smokables, crafting items, rolls of paper) at a forced
+	// scale. HIGGS drives held objects every frame and may rewrite their transforms;
+	// the enforcer remembers the last scale it applied per reference and the 3D it
+	// applied it to, and only rewrites the scales and updates world data when the
+	// 3D changed or the scale no longer matches. A steady grab costs a handful of
+	// compares per frame.
+	// Game thread only.
+	// ============================================
+
+	// References tracked at once (both hands, plus items just released); oldest is reused
+	constexpr int SCALE_ENFORCER_MAX_REFS = 8;
+
+	class ScaleEnforcer
+	{
+	public:
+		static ScaleEnforcer& GetSingleton();
+
+		// Apply the scale now (one-shot changes: grab, drop, crafting hits) and remember it
+		void Apply(TESObjectREFR* refr, float targetScale);
+
+		// Per-frame: re-apply only if the 3D was replaced or its scale was overwritten.
+		// Returns true if the scale had to be re-applied.
+		bool Enforce(TESObjectREFR* refr, float targetScale);
+
+		// Forget every reference (game load)
+		void Clear();
+
+		// Counters
+		UInt64 GetChecks() const { return m_checks; }
+		UInt64 GetReapplies() const { return m_reapplies; }
+
+		// Write the counters to the log
+		void DumpStats();
+
+	private:
+		ScaleEnforcer();
+		ScaleEnforcer(const ScaleEnforcer&) = delete;
+		ScaleEnforcer& operator=(const ScaleEnforcer&) = delete;
+
+		struct Entry
+		{
+			TESObjectREFR* refr;
+			NiNode* root;       // 3D the scale was applied to (identity only, never dereferenced)
+			float scale;
+			UInt64 lastUse;     // Operation stamp, for reuse of the oldest slot
+		};
+
+		// Write the scale to the root and its direct children, then update world data
+		static void WriteScale(NiNode* rootNode, float targetScale);
+
+		// True if the root or a child no longer carries the scale
+		static bool IsScaleOverwritten(NiNode* rootNode, float targetScale);
+
+		// Entry for a reference, claiming the oldest slot if it is not tracked yet
+		Entry& GetEntry(TESObjectREFR* refr);
+
+		Entry m_entries[SCALE_ENFORCER_MAX_REFS];
+		UInt64 m_stamp;
+
+		UInt64 m_applies;
+		UInt64 m_checks;
+		UInt64 m_reapplies;
+		UInt64 m_overwrites;
+		UInt64 m_reattaches;
+	};
+}
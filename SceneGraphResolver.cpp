@@ -0,0 +1,126 @@
+#include "SceneGraphResolver.h"
+#include "skse64/GameTypes.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// SceneGraphResolver Implementation
+	// ============================================
+
+	SceneGraphResolver::SceneGraphResolver()
+		: m_targetCount(0)
+		, m_internedCount(0)
+		, m_walks(0)
+		, m_nodesVisited(0)
+		, m_stackOverflows(0)
+	{
+		for (int i = 0; i < SCENE_RESOLVER_MAX_TARGETS; i++)
+		{
+			m_targetNames[i] = nullptr;
+			m_internedNames[i] = nullptr;
+		}
+	}
+
+	int SceneGraphResolver::AddTarget(const char* name)
+	{
+		if (!name || m_targetCount >= SCENE_RESOLVER_MAX_TARGETS)
+			return -1;
+
+		m_targetNames[m_targetCount] = name;
+		return m_targetCount++;
+	}
+
+	void SceneGraphResolver::InternTargets()
+	{
+		for (; m_internedCount < m_targetCount; m_internedCount++)
+		{
+			// Intentionally never released - the reference keeps the pool entry (and its pointer) alive
+			BSFixedString* interned = new BSFixedString(m_targetNames[m_internedCount]);
+			m_internedNames[m_internedCount] = interned->data;
+		}
+	}
+
+	int SceneGraphResolver::Resolve(NiAVObject* const* roots, int rootCount, NiAVObject** results)
+	{
+		if (!results || m_targetCount == 0)
+			return 0;
+
+		InternTargets();
+
+		int resolved = 0;
+		for (int t = 0; t < m_targetCount; t++)
+		{
+			if (results[t])
+				resolved++;
+		}
+		if (resolved == m_targetCount || !roots)
+			return resolved;
+
+		m_walks++;
+
+		// Push roots in reverse so they are walked in the given order
+		int top = 0;
+		for (int r = rootCount - 1; r >= 0; r--)
+		{
+			NiAVObject* root = roots[r];
+			if (!root)
+				continue;
+
+			bool repeated = false;
+			for (int other = 0; other < r; other++)
+			{
+				if (roots[other] == root)
+				{
+					repeated = true;
+					break;
+				}
+			}
+
+			if (!repeated && top < SCENE_RESOLVER_STACK_SIZE)
+			{
+				m_stack[top++] = root;
+			}
+		}
+
+		while (top > 0)
+		{
+			NiAVObject* object = m_stack[--top];
+			m_nodesVisited++;
+
+			const char* name = object->m_name;
+			if (name)
+			{
+				for (int t = 0; t < m_targetCount; t++)
+				{
+					if (!results[t] && name == m_internedNames[t])
+					{
+						results[t] = object;
+						if (++resolved == m_targetCount)
+							return resolved;
+					}
+				}
+			}
+
+			NiNode* node = object->GetAsNiNode();
+			if (!node)
+				continue;
+
+			// Push children in reverse so the first child is visited first (same order as a recursive walk)
+			for (int i = static_cast<int>(node->m_children.m_size) - 1; i >= 0; i--)
+			{
+				NiAVObject* child = node->m_children.m_data[i];
+				if (!child)
+					continue;
+
+				if (top >= SCENE_RESOLVER_STACK_SIZE)
+				{
+					m_stackOverflows++;
+					continue;
+				}
+				m_stack[top++] = child;
+			}
+		}
+
+		return resolved;
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "skse64/NiNodes.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Scene Graph Resolver
+	// Finds several named nodes in one depth-first walk over one or more roots.
+	// Target names are interned into the game's string pool (BSFixedString) on
+	// first use; node names live in the same pool, so matching is a pointer
+	// compare instead of a string compare. The pool folds case, so matching is
+	// case-insensitive. The walk uses a fixed explicit stack - no recursion,
+	// no allocation.
+	// Game thread only.
+	// ============================================
+
+	constexpr int SCENE_RESOLVER_MAX_TARGETS = 8;
+
+	// Pending nodes the walk can hold; subtrees that don't fit are skipped (counted)
+	constexpr int SCENE_RESOLVER_STACK_SIZE = 1024;
+
+	class SceneGraphResolver
+	{
+	public:
+		SceneGraphResolver();
+
+		// Register a target name (must outlive the resolver - use string literals). Returns its index, -1 if full.
+		int AddTarget(const char* name);
+
+		int GetTargetCount() const { return m_targetCount; }
+
+		// Walk the roots (in order, null and repeated roots skipped) and store the first match for
+		// every target in results[index] (nullptr if not found). Targets whose results[] entry is
+		// already set are not searched for. Stops as soon as every target is resolved.
+		// Returns the number of targets resolved.
+		int Resolve(NiAVObject* const* roots, int rootCount, NiAVObject** results);
+
+		// Counters
+		UInt64 GetWalks() const { return m_walks; }
+		UInt64 GetNodesVisited() const { return m_nodesVisited; }
+		UInt64 GetStackOverflows() const { return m_stackOverflows; }
+
+	private:
+		SceneGraphResolver(const SceneGraphResolver&) = delete;
+		SceneGraphResolver& operator=(const SceneGraphResolver&) = delete;
+
+		// Intern the target names into the game's string pool (once, game must be running)
+		void InternTargets();
+
+		const char* m_targetNames[SCENE_RESOLVER_MAX_TARGETS];
+		const char* m_internedNames[SCENE_RESOLVER_MAX_TARGETS];  // Pool pointers, compared against m_name
+		int m_targetCount;
+		int m_internedCount;
+
+		NiAVObject* m_stack[SCENE_RESOLVER_STACK_SIZE];
+
+		UInt64 m_walks;
+		UInt64 m_nodesVisited;
+		UInt64 m_stackOverflows;
+	};
+}
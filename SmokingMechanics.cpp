@@ -4,6 +4,8 @@
 #include "Helper.h"
 #include "SmokableIngredients.h"
 
+#include "ImadEngine.h"
+#include "SceneGraphResolver.h"
 #include "config.h"
 
 #include "skse64/GameReferences.h"
@@ -12,8 +14,6 @@
 
 #include <chrono>
 #include <cmath>
-#include <thread>
-#include <atomic>
 #include <vector>
 
 namespace InteractivePipeSmokingVR
@@ -58,8 +58,8 @@ namespace InteractivePipeSmokingVR
 	static float s_currentRecreationalStrength = 0.0f;
 	static bool s_recreationalEffectActive = false;
 	
-	// Track active IMAD count (for max limit)
-	static std::atomic<int> s_activeRecreationalIMADCount{0};
+	// Fade in/out time of each stacked recreational IMAD curve (active count comes from the ImadEngine)
+	static const float RECREATIONAL_IMAD_FADE_SECONDS = 2.0f;
 
 	// Cooldown for recreational effect (65 seconds)
 	static const int RECREATIONAL_COOLDOWN_SECONDS = 65;
@@ -81,33 +81,42 @@ namespace InteractivePipeSmokingVR
 	// ============================================
 	// Glow Node State
 	// ============================================
-	static NiAVObject* s_cachedGlowNode = nullptr;
+	// Holds a reference, so the node stays allocated until the handle is dropped
+	static NiPointer<NiAVObject> s_cachedGlowNode;
 	static float s_glowNodeDefaultScale = 1.0f;
 	static bool s_glowNodeVisible = false;
 	static bool s_prevInhaling = false;
 
-	// Helper to check if the cached glow node is still valid
+	// Pending glow node discovery (armed when the lit pipe is equipped, advanced once per frame)
+	static bool s_glowNodeSearchPending = false;
+	static UInt32 s_glowNodeSearchFrames = 0;
+	static UInt32 s_glowNodeSearchWalks = 0;
+	static std::chrono::steady_clock::time_point s_glowNodeSearchStart;
+
+	// Give up if the lit pipe's 3D has not attached this long after the equip
+	static const int GLOW_NODE_SEARCH_TIMEOUT_MS = 3000;
+
+	// The 3D usually attaches within a few frames - search every frame for this long,
+	// then only every GLOW_NODE_SEARCH_STRIDE frames (armors without the node would
+	// otherwise walk the scene roots every frame until the timeout)
+	static const int GLOW_NODE_SEARCH_EVERY_FRAME_MS = 100;
+	static const UInt32 GLOW_NODE_SEARCH_STRIDE = 8;
+
+	// Helper to check if the cached glow node is still valid.
+	// Removing the armor's 3D detaches the node from the player's skeleton; the handle keeps the
+	// detached node alive, so reading m_parent is safe and a detached node drops the handle.
 	static bool IsGlowNodeValid()
 	{
 		if (!s_cachedGlowNode)
 			return false;
 
-		// Check if the node pointer is still valid by checking its vtable
-		// This is a basic sanity check - the node might have been deleted
-		__try
+		if (!s_cachedGlowNode->m_parent)
 		{
-			// Try to access the node's name - if it crashes, the node is invalid
-			const char* name = s_cachedGlowNode->m_name;
-			if (name && strcmp(name, GLOW_NODE_NAME) == 0)
-				return true;
-			return false;
-		}
-		__except (EXCEPTION_EXECUTE_HANDLER)
-		{
-			// Node is invalid, clear the cache
+			_MESSAGE("[GlowNode] Glow node detached - releasing handle");
 			s_cachedGlowNode = nullptr;
 			return false;
 		}
+		return true;
 	}
 
 	// ============================================
@@ -246,6 +255,7 @@ namespace InteractivePipeSmokingVR
 
 		// Reset glow node state
 		s_cachedGlowNode = nullptr;
+		s_glowNodeSearchPending = false;
 		s_glowNodeVisible = false;
 		s_prevInhaling = false;
 	}
@@ -270,7 +280,7 @@ namespace InteractivePipeSmokingVR
 		// Reset recreational effect state
 		s_recreationalEffectActive = false;
 		s_currentRecreationalStrength = 0.0f;
-		s_activeRecreationalIMADCount = 0;
+		ImadEngine::GetSingleton().Clear();  // Applied IMADs are removed over the next frames
 		s_recreationalInitialized = false;
 		// s_lastRecreationalTime will be set fresh on next use
 
@@ -456,95 +466,47 @@ namespace InteractivePipeSmokingVR
 	// Glow Node Control Functions
 	// ============================================
 
-	// Helper to find a node by name recursively
-	static NiAVObject* FindNodeByNameRecursive(NiAVObject* root, const char* nodeName)
-	{
-		if (!root || !nodeName)
-			return nullptr;
+	// Finds the glow node across the player's 3D roots in one walk
+	static SceneGraphResolver s_glowNodeResolver;
 
-		// Check if this node matches
-		if (root->m_name && strcmp(root->m_name, nodeName) == 0)
-			return root;
-
-		// If it's a NiNode, search children
-		NiNode* node = root->GetAsNiNode();
-		if (node)
-		{
-			for (UInt32 i = 0; i < node->m_children.m_size; ++i)
-			{
-				NiAVObject* child = node->m_children.m_data[i];
-				if (child)
-				{
-					NiAVObject* found = FindNodeByNameRecursive(child, nodeName);
-					if (found)
-						return found;
-				}
-			}
-		}
-
-		return nullptr;
-	}
-
-	void FindAndCacheGlowNode()
+	bool FindAndCacheGlowNode()
 	{
 		s_cachedGlowNode = nullptr;
 
 		Actor* player = *g_thePlayer;
 		if (!player)
-		{
-			_MESSAGE("[GlowNode] Player not available");
-			return;
-		}
+			return false;
 
 		// Get the player's 3D root node
 		NiNode* playerRoot = player->GetNiNode();
 		if (!playerRoot)
-		{
-			_MESSAGE("[GlowNode] Player root node not available");
-			return;
-		}
+			return false;
 
-		// The glow node is on the lit pipe armor mesh, which is attached to the player skeleton
-		// We need to search the entire player skeleton hierarchy for the node
-		// The armor mesh should be attached somewhere under the player's skeleton
-		
-		// First try to find by searching the whole player hierarchy
-		NiAVObject* glowNode = FindNodeByNameRecursive(playerRoot, GLOW_NODE_NAME);
-		
-		// If not found on player root, try the first person skeleton
-		if (!glowNode)
+		// The glow node is on the lit pipe armor mesh, which is attached to the player skeleton.
+		// Search the player root, the first person skeleton and the loaded 3D state in one walk
+		// (roots that are the same node are only walked once).
+		if (s_glowNodeResolver.GetTargetCount() == 0)
 		{
-			PlayerCharacter* playerChar = DYNAMIC_CAST(player, Actor, PlayerCharacter);
-			if (playerChar && playerChar->firstPersonSkeleton)
-			{
-				glowNode = FindNodeByNameRecursive(playerChar->firstPersonSkeleton, GLOW_NODE_NAME);
-				if (glowNode)
-				{
-					_MESSAGE("[GlowNode] Found '%s' on first person skeleton", GLOW_NODE_NAME);
-				}
-			}
+			s_glowNodeResolver.AddTarget(GLOW_NODE_NAME);
 		}
 
-		// If still not found, try the loaded 3D state
-		if (!glowNode && player->loadedState && player->loadedState->node)
-		{
-			glowNode = FindNodeByNameRecursive(player->loadedState->node, GLOW_NODE_NAME);
-			if (glowNode)
-			{
-				_MESSAGE("[GlowNode] Found '%s' on loaded state node", GLOW_NODE_NAME);
-			}
-		}
+		PlayerCharacter* playerChar = DYNAMIC_CAST(player, Actor, PlayerCharacter);
+		NiAVObject* roots[] = {
+			playerRoot,
+			playerChar ? playerChar->firstPersonSkeleton : nullptr,
+			player->loadedState ? player->loadedState->node : nullptr
+		};
 
-		if (glowNode)
-		{
-			s_cachedGlowNode = glowNode;
-			s_glowNodeDefaultScale = glowNode->m_localTransform.scale;
-			_MESSAGE("[GlowNode] Found and cached '%s' node (default scale: %.2f)", GLOW_NODE_NAME, s_glowNodeDefaultScale);
-		}
-		else
-		{
-			_MESSAGE("[GlowNode] WARNING: Could not find '%s' node in player hierarchy", GLOW_NODE_NAME);
-		}
+		NiAVObject* glowNode = nullptr;
+		s_glowNodeResolver.Resolve(roots, static_cast<int>(sizeof(roots) / sizeof(roots[0])), &glowNode);
+
+		if (!glowNode)
+			return false;
+
+		s_cachedGlowNode = glowNode;
+		s_glowNodeDefaultScale = glowNode->m_localTransform.scale;
+		_MESSAGE("[GlowNode] Found and cached '%s' node (default scale: %.2f)", GLOW_NODE_NAME, s_glowNodeDefaultScale);
+		return true;
 	}
 
 	void ShowGlowNode()
@@ -611,52 +573,55 @@ namespace InteractivePipeSmokingVR
 		s_prevInhaling = g_isInhaling;
 	}
 
-	// Thread function to find glow node after delay (with retry)
-	static void DelayedFindGlowNodeThread(int delayMs)
-	{
-		// Initial delay to allow armor mesh to load
-		std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-		
-		// Try to find the node, with retries
-		const int MAX_RETRIES = 5;
-		const int RETRY_DELAY_MS = 200;
-
-		for (int attempt = 0; attempt < MAX_RETRIES; ++attempt)
-		{
-			// Find and cache the glow node
-			FindAndCacheGlowNode();
-
-			// If found, hide it and we're done
-			if (s_cachedGlowNode)
-			{
-				HideGlowNode();
-				_MESSAGE("[GlowNode] Successfully found glow node on attempt %d", attempt + 1);
-				return;
-			}
-
-			// Wait before retry
-			if (attempt < MAX_RETRIES - 1)
-			{
-				_MESSAGE("[GlowNode] Node not found, retrying in %dms (attempt %d/%d)", RETRY_DELAY_MS, attempt + 1, MAX_RETRIES);
-				std::this_thread::sleep_for(std::chrono::milliseconds(RETRY_DELAY_MS));
-			}
-		}
-
-		_MESSAGE("[GlowNode] WARNING: Failed to find glow node after %d attempts", MAX_RETRIES);
-	}
-
 	void OnLitPipeEquipped()
 	{
-		_MESSAGE("[GlowNode] Lit pipe equipped - scheduling glow node search in 500ms");
+		_MESSAGE("[GlowNode] Lit pipe equipped - searching for glow node as its 3D attaches");
 		
 		// Reset glow state
 		s_cachedGlowNode = nullptr;
 		s_glowNodeVisible = true;  // Assume visible initially so HideGlowNode will work
 		s_prevInhaling = false;
 
-		// Find glow node after 500ms delay to allow armor mesh to fully load
-		std::thread findThread(DelayedFindGlowNodeThread, 500);
-		findThread.detach();
+		// The armor's 3D is attached by the game some frames after the equip - look for the
+		// node from the frame services and hide it on the first frame it is found
+		s_glowNodeSearchPending = true;
+		s_glowNodeSearchFrames = 0;
+		s_glowNodeSearchWalks = 0;
+		s_glowNodeSearchStart = std::chrono::steady_clock::now();
+	}
+
+	void UpdateGlowNodeDiscovery()
+	{
+		if (!s_glowNodeSearchPending)
+			return;
+
+		s_glowNodeSearchFrames++;
+
+		auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - s_glowNodeSearchStart).count();
+
+		bool searchThisFrame = elapsedMs < GLOW_NODE_SEARCH_EVERY_FRAME_MS ||
+			(s_glowNodeSearchFrames % GLOW_NODE_SEARCH_STRIDE) == 0 ||
+			elapsedMs >= GLOW_NODE_SEARCH_TIMEOUT_MS;
+		if (!searchThisFrame)
+			return;
+
+		s_glowNodeSearchWalks++;
+		if (FindAndCacheGlowNode())
+		{
+			s_glowNodeSearchPending = false;
+			HideGlowNode();
+			_MESSAGE("[GlowNode] Glow node attached after %u frame(s) (%lldms, %u searches)", s_glowNodeSearchFrames,
+				static_cast<long long>(elapsedMs), s_glowNodeSearchWalks);
+			return;
+		}
+
+		if (elapsedMs >= GLOW_NODE_SEARCH_TIMEOUT_MS)
+		{
+			s_glowNodeSearchPending = false;
+			_MESSAGE("[GlowNode] WARNING: '%s' node did not appear within %dms (%u frames, %u searches)", GLOW_NODE_NAME,
+				GLOW_NODE_SEARCH_TIMEOUT_MS, s_glowNodeSearchFrames, s_glowNodeSearchWalks);
+		}
 	}
 
 	// ============================================
@@ -732,10 +697,28 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[Effect] Applied STAMINA_REGEN: +%.1f Stamina, -%.1f Magicka", configEffectStaminaRegenStamina, configEffectStaminaRegenMagickaCost);
 	}
 
+	// ImadEngine callback - one stacked recreational IMAD curve has fully faded out
+	static void OnRecreationalIMADExpired(UInt32 formId, ImadChannel channel)
+	{
+		// Remaining stacked curves (this one has already been dropped by the engine)
+		int remaining = ImadEngine::GetSingleton().GetActiveCurveCount(channel);
+
+		_MESSAGE("[Effect] RECREATIONAL: IMAD %08X expired after %.1f seconds (remaining active: %d)", 
+			formId, configRecreationalEffectDuration, remaining);
+
+		// If no more active IMADs, reset state
+		if (remaining <= 0)
+		{
+			s_recreationalEffectActive = false;
+			s_recreationalInhaleCount = 0;
+			_MESSAGE("[Effect] RECREATIONAL: All effects expired, state reset");
+		}
+	}
+
 	void ApplyRecreationalEffect()
 	{
 		// Apply Recreational Effect: Apply a random IMAD on each inhale, stacking on top of previous ones
-		// Each IMAD has its own independent duration timer
+		// Each inhale adds its own curve with an independent duration
 		// Strength is configRecreationalEffectStrength (default 0.09) per inhale
 		// Maximum active IMADs controlled by configRecreationalMaxInhales
 		
@@ -761,7 +744,7 @@ namespace InteractivePipeSmokingVR
 		s_recreationalInhaleCount++;
 		
 		// Check if we've reached max active IMADs
-		int currentActiveCount = s_activeRecreationalIMADCount.load();
+		int currentActiveCount = ImadEngine::GetSingleton().GetActiveCurveCount(ImadChannel::Recreational);
 		if (currentActiveCount >= configRecreationalMaxInhales)
 		{
 			_MESSAGE("[Effect] RECREATIONAL: Inhale #%d - already at max active IMADs (%d), waiting for one to expire", 
@@ -769,40 +752,28 @@ namespace InteractivePipeSmokingVR
 			return;
 		}
 		
-		// Increment active count
-		s_activeRecreationalIMADCount++;
+		// Stack a curve for THIS inhale: fade in, hold, fade out over the configured duration.
+		// The engine sums stacked curves on the same IMAD, so strength grows with each inhale.
+		float fadeSeconds = RECREATIONAL_IMAD_FADE_SECONDS;
+		if (fadeSeconds * 2.0f > configRecreationalEffectDuration)
+		{
+			fadeSeconds = configRecreationalEffectDuration * 0.5f;
+		}
+		float holdSeconds = configRecreationalEffectDuration - fadeSeconds * 2.0f;
+
+		if (!ImadEngine::GetSingleton().AddCurve(fullFormId, configRecreationalEffectStrength, fadeSeconds, holdSeconds, fadeSeconds,
+			ImadChannel::Recreational, OnRecreationalIMADExpired))
+		{
+			return;
+		}
 		s_recreationalEffectActive = true;
-		
-		// Apply the IMAD at configured strength
+
 		_MESSAGE("[Effect] RECREATIONAL: Inhale #%d - applying IMAD %08X at strength %.2f (active: %d/%d)", 
 			s_recreationalInhaleCount, fullFormId, configRecreationalEffectStrength, 
-			s_activeRecreationalIMADCount.load(), configRecreationalMaxInhales);
-		ApplyImageSpaceModifier(fullFormId, configRecreationalEffectStrength, 0.0f);  // 0 duration = indefinite
+			currentActiveCount + 1, configRecreationalMaxInhales);
 		
 		// Advance game time by 1 hour on each inhale
 		AdvanceGameTime(1.0f);
-		
-		// Schedule removal for THIS specific IMAD after configured duration
-		std::thread([fullFormId]() {
-			std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(configRecreationalEffectDuration * 1000.0f)));
-			
-			// Remove this specific IMAD
-			RemoveImageSpaceModifier(fullFormId);
-			
-			// Decrement active count
-			int remaining = --s_activeRecreationalIMADCount;
-			
-			_MESSAGE("[Effect] RECREATIONAL: IMAD %08X expired after %.1f seconds (remaining active: %d)", 
-				fullFormId, configRecreationalEffectDuration, remaining);
-			
-			// If no more active IMADs, reset state
-			if (remaining <= 0)
-			{
-				s_recreationalEffectActive = false;
-				s_recreationalInhaleCount = 0;
-				_MESSAGE("[Effect] RECREATIONAL: All effects expired, state reset");
-			}
-		}).detach();
 	}
 
 	void ApplyRandomEffect()
@@ -52,11 +52,14 @@ namespace InteractivePipeSmokingVR
 	// Glow Node Control Functions
 	// ============================================
 
-	// Called when lit pipe is equipped (with delay to allow mesh loading)
+	// Called when lit pipe is equipped - arms the glow node search for when its 3D attaches
 	void OnLitPipeEquipped();
 
-	// Find and cache the glow node from the player's equipped armor
-	void FindAndCacheGlowNode();
+	// Advance a pending glow node search (call once per frame, game thread)
+	void UpdateGlowNodeDiscovery();
+
+	// Find and cache the glow node from the player's equipped armor (false if its 3D is not attached yet)
+	bool FindAndCacheGlowNode();
 
 	// Show the glow node (scale to default)
 	void ShowGlowNode();
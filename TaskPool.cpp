@@ -0,0 +1,98 @@
+#include "TaskPool.h"
+#include <new>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// TaskPool Implementation
+	// ============================================
+
+	TaskPool& TaskPool::GetSingleton()
+	{
+		static TaskPool instance;
+		return instance;
+	}
+
+	TaskPool::TaskPool()
+		: m_freeCount(kSlotCount)
+		, m_inUse(0)
+		, m_highWaterMark(0)
+		, m_totalAllocations(0)
+		, m_overflowCount(0)
+	{
+		// Lowest slots on top of the stack so a light load stays in the same few cache lines
+		for (int i = 0; i < kSlotCount; i++)
+		{
+			m_freeSlots[i] = kSlotCount - 1 - i;
+		}
+	}
+
+	bool TaskPool::OwnsPointer(const void* ptr) const
+	{
+		const unsigned char* p = static_cast<const unsigned char*>(ptr);
+		return p >= &m_storage[0][0] && p < &m_storage[0][0] + sizeof(m_storage);
+	}
+
+	void* TaskPool::Allocate(size_t size)
+	{
+		{
+			std::scoped_lock lock(m_lock);
+			m_totalAllocations++;
+
+			if (size <= kSlotSize && m_freeCount > 0)
+			{
+				int slot = m_freeSlots[--m_freeCount];
+				m_inUse++;
+				if (m_inUse > m_highWaterMark)
+				{
+					m_highWaterMark = m_inUse;
+				}
+				return m_storage[slot];
+			}
+
+			m_overflowCount++;
+		}
+
+		// Pool exhausted (or oversized task) - fall back to the heap
+		return ::operator new(size);
+	}
+
+	void TaskPool::Free(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		if (!OwnsPointer(ptr))
+		{
+			::operator delete(ptr);
+			return;
+		}
+
+		int slot = static_cast<int>((static_cast<unsigned char*>(ptr) - &m_storage[0][0]) / kSlotSize);
+
+		std::scoped_lock lock(m_lock);
+		m_freeSlots[m_freeCount++] = slot;
+		m_inUse--;
+	}
+
+	void TaskPool::DumpStats()
+	{
+		std::scoped_lock lock(m_lock);
+		_MESSAGE("[TaskPool] Slots: %d x %d bytes, in use: %d, high-water mark: %d, allocations: %llu, overflows: %llu",
+			kSlotCount, static_cast<int>(kSlotSize), m_inUse, m_highWaterMark, m_totalAllocations, m_overflowCount);
+	}
+
+	// ============================================
+	// PooledTaskDelegate Implementation
+	// ============================================
+
+	void* PooledTaskDelegate::operator new(size_t size)
+	{
+		return TaskPool::GetSingleton().Allocate(size);
+	}
+
+	void PooledTaskDelegate::operator delete(void* ptr)
+	{
+		TaskPool::GetSingleton().Free(ptr);
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "skse64/gamethreads.h"
+#include <mutex>
+#include <cstddef>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Task Pool
+	// Fixed-capacity, thread-safe freelist of equal-size slots for TaskDelegate objects.
+	// Tasks are queued from the scheduler/worker threads and disposed on the game thread,
+	// so every Allocate/Free is mutex-protected. When the pool is full (or a task is larger
+	// than a slot) the allocation falls back to the heap and is counted as an overflow.
+	// ============================================
+	class TaskPool
+	{
+	public:
+		// Every pooled task must fit in one slot (vtable + a few form IDs/floats)
+		static constexpr size_t kSlotSize = 64;
+		static constexpr int kSlotCount = 128;
+
+		static TaskPool& GetSingleton();
+
+		void* Allocate(size_t size);
+		void Free(void* ptr);
+
+		// Counters
+		int GetInUse() const { return m_inUse; }
+		int GetHighWaterMark() const { return m_highWaterMark; }
+		UInt64 GetTotalAllocations() const { return m_totalAllocations; }
+		UInt64 GetOverflowCount() const { return m_overflowCount; }
+
+		// Write the counters to the log
+		void DumpStats();
+
+	private:
+		TaskPool();
+		TaskPool(const TaskPool&) = delete;
+		TaskPool& operator=(const TaskPool&) = delete;
+
+		bool OwnsPointer(const void* ptr) const;
+
+		alignas(16) unsigned char m_storage[kSlotCount][kSlotSize];
+
+		// Stack of free slot indices
+		int m_freeSlots[kSlotCount];
+		int m_freeCount;
+
+		std::mutex m_lock;
+
+		int m_inUse;
+		int m_highWaterMark;
+		UInt64 m_totalAllocations;
+		UInt64 m_overflowCount;
+	};
+
+	// ============================================
+	// Pooled Task Delegate
+	// Base for our TaskDelegate subclasses - new/delete go through TaskPool,
+	// so Dispose() { delete this; } hands the slot back to the pool.
+	// ============================================
+	class PooledTaskDelegate : public TaskDelegate
+	{
+	public:
+		static void* operator new(size_t size);
+		static void operator delete(void* ptr);
+	};
+}
@@ -0,0 +1,274 @@
+#include "TimerService.h"
+#include <cstring>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// TimerService Implementation
+	// ============================================
+
+	TimerService& TimerService::GetSingleton()
+	{
+		static TimerService instance;
+		return instance;
+	}
+
+	TimerService::TimerService()
+		: m_freeHead(0)
+		, m_currentTick(0)
+		, m_startTime(std::chrono::steady_clock::now())
+		, m_activeCount(0)
+		, m_highWaterMark(0)
+		, m_timersFired(0)
+		, m_overflowCount(0)
+		, m_generation(0)
+		, m_cancellableCount(0)
+		, m_staleDropped(0)
+	{
+		for (int i = 0; i < kMaxTimers; i++)
+		{
+			m_entries[i].expiry = 0;
+			m_entries[i].callback = nullptr;
+			m_entries[i].generation = 0;
+			m_entries[i].flags = 0;
+			m_entries[i].next = (i + 1 < kMaxTimers) ? i + 1 : -1;
+		}
+
+		for (int level = 0; level < kWheelLevels; level++)
+		{
+			for (int slot = 0; slot < kWheelSlots; slot++)
+			{
+				m_slots[level][slot] = -1;
+			}
+		}
+	}
+
+	UInt64 TimerService::GetNowTick() const
+	{
+		return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - m_startTime).count());
+	}
+
+	bool TimerService::Schedule(int delayMs, TimerCallback callback, const TimerPayload& payload, UInt32 flags)
+	{
+		if (!callback)
+			return false;
+
+		if (delayMs < 0)
+			delayMs = 0;
+
+		std::scoped_lock lock(m_lock);
+
+		if (m_freeHead < 0)
+		{
+			m_overflowCount++;
+			_MESSAGE("[TimerService] WARNING: Timer pool exhausted (%d active) - dropping timer", m_activeCount);
+			return false;
+		}
+
+		int index = m_freeHead;
+		m_freeHead = m_entries[index].next;
+
+		TimerEntry& entry = m_entries[index];
+		entry.callback = callback;
+		entry.payload = payload;
+		entry.payload.text[sizeof(entry.payload.text) - 1] = '\0';
+		entry.generation = m_generation;
+		entry.flags = flags;
+		if (!(flags & kTimerSurvivesReset))
+		{
+			m_cancellableCount++;
+		}
+
+		// Count from "now" rather than the last processed tick so a late frame doesn't shorten the delay
+		UInt64 now = GetNowTick();
+		entry.expiry = (now > m_currentTick ? now : m_currentTick) + static_cast<UInt64>(delayMs);
+
+		// Nothing was pending - skip the wheel straight to the present instead of stepping through idle ticks
+		if (m_activeCount == 0 && now > m_currentTick)
+		{
+			m_currentTick = now;
+		}
+
+		InsertEntry(index);
+
+		m_activeCount++;
+		if (m_activeCount > m_highWaterMark)
+		{
+			m_highWaterMark = m_activeCount;
+		}
+		return true;
+	}
+
+	bool TimerService::Schedule(int delayMs, TimerCallback callback, UInt32 formId, UInt32 param)
+	{
+		TimerPayload payload;
+		payload.formId = formId;
+		payload.param = param;
+		return Schedule(delayMs, callback, payload);
+	}
+
+	bool TimerService::Schedule(int delayMs, TimerCallback callback, UInt32 formId, UInt32 param, const char* text)
+	{
+		TimerPayload payload;
+		payload.formId = formId;
+		payload.param = param;
+		if (text)
+		{
+			strncpy_s(payload.text, sizeof(payload.text), text, _TRUNCATE);
+		}
+		return Schedule(delayMs, callback, payload);
+	}
+
+	void TimerService::InsertEntry(int index)
+	{
+		TimerEntry& entry = m_entries[index];
+		UInt64 expiry = entry.expiry > m_currentTick ? entry.expiry : m_currentTick;
+		UInt64 delta = expiry - m_currentTick;
+
+		int level;
+		UInt64 slotTick = expiry;
+		if (delta < (1ULL << kWheelBits))
+		{
+			level = 0;
+		}
+		else if (delta < (1ULL << (kWheelBits * 2)))
+		{
+			level = 1;
+		}
+		else
+		{
+			// Beyond the wheel range: park in the furthest level 2 slot, it re-cascades with its real expiry
+			level = 2;
+			UInt64 maxDelta = (1ULL << (kWheelBits * 3)) - 1;
+			if (delta > maxDelta)
+			{
+				slotTick = m_currentTick + maxDelta;
+			}
+		}
+
+		int slot = static_cast<int>((slotTick >> (kWheelBits * level)) & (kWheelSlots - 1));
+		entry.next = m_slots[level][slot];
+		m_slots[level][slot] = index;
+	}
+
+	void TimerService::Cascade(int level, int slot)
+	{
+		int index = m_slots[level][slot];
+		m_slots[level][slot] = -1;
+
+		while (index >= 0)
+		{
+			int next = m_entries[index].next;
+			InsertEntry(index);
+			index = next;
+		}
+	}
+
+	void TimerService::Tick()
+	{
+		int expiredHead = -1;
+		int expiredTail = -1;
+
+		{
+			std::scoped_lock lock(m_lock);
+
+			UInt64 now = GetNowTick();
+
+			if (m_activeCount == 0)
+			{
+				m_currentTick = now + 1;
+				return;
+			}
+
+			while (m_currentTick <= now)
+			{
+				// Entering a new level 0 revolution - pull the matching higher-level slots down
+				if ((m_currentTick & (kWheelSlots - 1)) == 0)
+				{
+					int slot1 = static_cast<int>((m_currentTick >> kWheelBits) & (kWheelSlots - 1));
+					if (slot1 == 0)
+					{
+						Cascade(2, static_cast<int>((m_currentTick >> (kWheelBits * 2)) & (kWheelSlots - 1)));
+					}
+					Cascade(1, slot1);
+				}
+
+				// Collect everything in the current level 0 slot
+				int slot0 = static_cast<int>(m_currentTick & (kWheelSlots - 1));
+				int index = m_slots[0][slot0];
+				m_slots[0][slot0] = -1;
+				while (index >= 0)
+				{
+					int next = m_entries[index].next;
+					m_entries[index].next = -1;
+					if (expiredTail >= 0)
+						m_entries[expiredTail].next = index;
+					else
+						expiredHead = index;
+					expiredTail = index;
+					index = next;
+				}
+
+				m_currentTick++;
+			}
+		}
+
+		// Run callbacks without holding the lock (they may schedule new timers)
+		while (expiredHead >= 0)
+		{
+			TimerCallback callback = nullptr;
+			TimerPayload payload;
+			int index = expiredHead;
+
+			{
+				std::scoped_lock lock(m_lock);
+				TimerEntry& entry = m_entries[index];
+				expiredHead = entry.next;
+
+				bool cancellable = !(entry.flags & kTimerSurvivesReset);
+				if (cancellable && entry.generation != m_generation)
+				{
+					// Scheduled before the last reset - drop it
+					m_staleDropped++;
+				}
+				else
+				{
+					callback = entry.callback;
+					payload = entry.payload;
+					if (cancellable)
+					{
+						m_cancellableCount--;
+					}
+					m_timersFired++;
+				}
+
+				entry.callback = nullptr;
+				entry.next = m_freeHead;
+				m_freeHead = index;
+				m_activeCount--;
+			}
+
+			if (callback)
+			{
+				callback(payload);
+			}
+		}
+	}
+
+	int TimerService::InvalidatePending()
+	{
+		std::scoped_lock lock(m_lock);
+		int invalidated = m_cancellableCount;
+		m_cancellableCount = 0;
+		m_generation++;
+		return invalidated;
+	}
+
+	void TimerService::DumpStats()
+	{
+		std::scoped_lock lock(m_lock);
+		_MESSAGE("[TimerService] Active: %d, high-water mark: %d/%d, fired: %llu, overflows: %llu, stale dropped: %llu (generation %u)",
+			m_activeCount, m_highWaterMark, kMaxTimers, m_timersFired, m_overflowCount, m_staleDropped, m_generation);
+	}
+}
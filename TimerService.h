@@ -0,0 +1,124 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Timer Service
+	// One place for every delayed action (delayed equips, weapon renames, glow node search,
+	// IMAD expiry). Timers live in a fixed entry pool and are sorted into a three-level
+	// hierarchical timer wheel with 1 ms resolution:
+	//   level 0: 64 x 1 ms      (up to 64 ms)
+	//   level 1: 64 x 64 ms     (up to ~4 s)
+	//   level 2: 64 x 4096 ms   (up to ~262 s, longer timers re-cascade)
+	// Tick() is called once per frame from the game thread (RunFrameServices), so callbacks always
+	// run on the game thread and fire within one frame of their deadline. Scheduling is thread-safe.
+	//
+	// Every timer is tagged with the session generation it was scheduled in. InvalidatePending()
+	// bumps the generation (O(1)) on reset/load, and stale timers are dropped when they come due.
+	// Cleanup timers (e.g. IMAD removal) can opt out with kTimerSurvivesReset.
+	// ============================================
+
+	// Data carried by a timer to its callback (copied into the timer entry)
+	struct TimerPayload
+	{
+		UInt32 formId = 0;
+		UInt32 param = 0;      // Extra integer (hand flag, category, attempt number...)
+		float value = 0.0f;
+		char text[64] = {};    // Short string (e.g. weapon base name), always null-terminated
+	};
+
+	// Called on the game thread when a timer expires
+	typedef void(*TimerCallback)(const TimerPayload& payload);
+
+	// Timer flags
+	enum TimerFlags : UInt32
+	{
+		kTimerCancelOnReset = 0,        // Default - dropped by InvalidatePending()
+		kTimerSurvivesReset = 1 << 0    // Cleanup work that must still run after a reset
+	};
+
+	class TimerService
+	{
+	public:
+		static constexpr int kMaxTimers = 256;
+		static constexpr int kWheelLevels = 3;
+		static constexpr int kWheelBits = 6;
+		static constexpr int kWheelSlots = 1 << kWheelBits;
+
+		static TimerService& GetSingleton();
+
+		// Run callback with payload on the game thread after delayMs. Returns false if the pool is full.
+		bool Schedule(int delayMs, TimerCallback callback, const TimerPayload& payload, UInt32 flags = kTimerCancelOnReset);
+
+		// Convenience overloads
+		bool Schedule(int delayMs, TimerCallback callback, UInt32 formId, UInt32 param = 0);
+		bool Schedule(int delayMs, TimerCallback callback, UInt32 formId, UInt32 param, const char* text);
+
+		// Advance the wheel to "now" and run expired callbacks (game thread, once per frame)
+		void Tick();
+
+		// Start a new session generation - every pending cancellable timer becomes stale.
+		// Returns the number of timers invalidated.
+		int InvalidatePending();
+
+		// Current session generation (callbacks of kTimerSurvivesReset timers can compare against it)
+		UInt32 GetGeneration() const { return m_generation; }
+
+		// Counters
+		int GetActiveCount() const { return m_activeCount; }
+		int GetHighWaterMark() const { return m_highWaterMark; }
+		UInt64 GetTimersFired() const { return m_timersFired; }
+		UInt64 GetOverflowCount() const { return m_overflowCount; }
+		UInt64 GetStaleDropped() const { return m_staleDropped; }
+
+		// Write the counters to the log
+		void DumpStats();
+
+	private:
+		struct TimerEntry
+		{
+			UInt64 expiry;          // Absolute wheel tick (ms since service start)
+			TimerCallback callback;
+			TimerPayload payload;
+			UInt32 generation;      // Session generation at schedule time
+			UInt32 flags;
+			int next;               // Next entry in the same slot / free list (-1 = end)
+		};
+
+		TimerService();
+		TimerService(const TimerService&) = delete;
+		TimerService& operator=(const TimerService&) = delete;
+
+		UInt64 GetNowTick() const;
+
+		// Place an allocated entry in the slot matching its expiry (lock held)
+		void InsertEntry(int index);
+
+		// Move every entry in a higher-level slot down the wheel (lock held)
+		void Cascade(int level, int slot);
+
+		TimerEntry m_entries[kMaxTimers];
+		int m_freeHead;
+
+		int m_slots[kWheelLevels][kWheelSlots];
+
+		// Next wheel tick to process
+		UInt64 m_currentTick;
+		std::chrono::steady_clock::time_point m_startTime;
+
+		std::mutex m_lock;
+
+		int m_activeCount;
+		int m_highWaterMark;
+		UInt64 m_timersFired;
+		UInt64 m_overflowCount;
+
+		// Session generation and the number of cancellable timers pending in it
+		UInt32 m_generation;
+		int m_cancellableCount;
+		UInt64 m_staleDropped;
+	};
+}
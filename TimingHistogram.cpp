@@ -0,0 +1,99 @@
+#include "TimingHistogram.h"
+#include <cstdio>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// TimingHistogram Implementation
+	// ============================================
+
+	// Upper bound (exclusive, in microseconds) of every bucket but the last, per scale
+	static const long long kBucketUpperBoundsUs[2][TimingHistogram::kBucketCount - 1] = {
+		{ 1000, 2000, 5000, 10000, 20000, 50000, 100000, 150000, 250000 },
+		{ 4000, 4500, 5000, 5250, 5500, 6000, 7000, 10000, 16000 }
+	};
+
+	static const char* kBucketLabels[2][TimingHistogram::kBucketCount] = {
+		{ "<1", "<2", "<5", "<10", "<20", "<50", "<100", "<150", "<250", "250+" },
+		{ "<4", "<4.5", "<5", "<5.25", "<5.5", "<6", "<7", "<10", "<16", "16+" }
+	};
+
+	TimingHistogram::TimingHistogram(HistogramScale scale)
+		: m_scale(scale)
+	{
+		Reset();
+	}
+
+	void TimingHistogram::Reset()
+	{
+		for (int i = 0; i < kBucketCount; i++)
+		{
+			m_buckets[i] = 0;
+		}
+		m_count = 0;
+		m_sumUs = 0;
+		m_minUs = 0;
+		m_maxUs = 0;
+	}
+
+	void TimingHistogram::Record(long long microseconds)
+	{
+		if (microseconds < 0)
+			microseconds = 0;
+
+		const long long* upperBounds = kBucketUpperBoundsUs[static_cast<int>(m_scale)];
+		int bucket = kBucketCount - 1;
+		for (int i = 0; i < kBucketCount - 1; i++)
+		{
+			if (microseconds < upperBounds[i])
+			{
+				bucket = i;
+				break;
+			}
+		}
+		m_buckets[bucket]++;
+
+		if (m_count == 0 || microseconds < m_minUs)
+			m_minUs = microseconds;
+		if (m_count == 0 || microseconds > m_maxUs)
+			m_maxUs = microseconds;
+
+		m_sumUs += microseconds;
+		m_count++;
+	}
+
+	float TimingHistogram::GetMinMs() const
+	{
+		return m_minUs / 1000.0f;
+	}
+
+	float TimingHistogram::GetMaxMs() const
+	{
+		return m_maxUs / 1000.0f;
+	}
+
+	float TimingHistogram::GetMeanMs() const
+	{
+		if (m_count == 0)
+			return 0.0f;
+		return (static_cast<float>(m_sumUs) / static_cast<float>(m_count)) / 1000.0f;
+	}
+
+	void TimingHistogram::Dump(const char* prefix, const char* label) const
+	{
+		_MESSAGE("%s %s: samples=%llu min=%.2f ms mean=%.2f ms max=%.2f ms",
+			prefix, label, m_count, GetMinMs(), GetMeanMs(), GetMaxMs());
+
+		if (m_count == 0)
+			return;
+
+		const char* const* labels = kBucketLabels[static_cast<int>(m_scale)];
+		char line[512];
+		int length = 0;
+		for (int i = 0; i < kBucketCount && length < static_cast<int>(sizeof(line)); i++)
+		{
+			length += snprintf(line + length, sizeof(line) - length, " %sms=%llu", labels[i], m_buckets[i]);
+		}
+		_MESSAGE("%s %s buckets:%s", prefix, label, line);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Timing Histogram
+	// Fixed-bucket histogram of durations (recorded in microseconds, bucketed in ms).
+	// Not thread-safe - record and dump from the same thread.
+	// ============================================
+
+	// Bucket layouts
+	enum class HistogramScale
+	{
+		Tracking,   // <1, <2, <5, <10, <20, <50, <100, <150, <250, 250+ ms
+		Pacing      // <4, <4.5, <5, <5.25, <5.5, <6, <7, <10, <16, 16+ ms (around the 5 ms haptic cadence)
+	};
+
+	class TimingHistogram
+	{
+	public:
+		static constexpr int kBucketCount = 10;
+
+		explicit TimingHistogram(HistogramScale scale = HistogramScale::Tracking);
+
+		void Reset();
+
+		// Record one sample (negative samples are clamped to 0)
+		void Record(long long microseconds);
+
+		UInt64 GetCount() const { return m_count; }
+		UInt64 GetBucket(int index) const { return (index >= 0 && index < kBucketCount) ? m_buckets[index] : 0; }
+
+		// Stats in milliseconds (0 when empty)
+		float GetMinMs() const;
+		float GetMaxMs() const;
+		float GetMeanMs() const;
+
+		// Write the summary and bucket counts to the log
+		void Dump(const char* prefix, const char* label) const;
+
+	private:
+		HistogramScale m_scale;
+		UInt64 m_buckets[kBucketCount];
+		UInt64 m_count;
+		long long m_sumUs;
+		long long m_minUs;
+		long long m_maxUs;
+	};
+}
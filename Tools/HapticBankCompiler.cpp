@@ -0,0 +1,157 @@
+// ============================================
+// Haptic Bank Compiler
+// Offline tool - compiles a text pattern description (see HapticPatterns.txt)
+// into the binary pattern bank the plugin memory-maps at startup.
+//
+// Build:  cl /EHsc /std:c++17 /O2 HapticBankCompiler.cpp
+// Usage:  HapticBankCompiler <input.txt> <output.hapticbank>
+//
+// The layout must match HapticBankHeader / HapticBankEntry in HapticPatternBank.h.
+// ============================================
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const uint32_t kBankMagic = 0x42485049;   // "IPHB" read as a little-endian uint32
+static const uint32_t kBankVersion = 1;
+static const int kNameLength = 24;
+
+#pragma pack(push, 1)
+struct BankHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t patternCount;
+	uint32_t sampleBytes;
+};
+
+struct BankEntry
+{
+	char name[kNameLength];
+	uint32_t sampleOffset;
+	uint32_t sampleCount;
+	float durationSeconds;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(BankHeader) == 16, "BankHeader layout");
+static_assert(sizeof(BankEntry) == 36, "BankEntry layout");
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "Usage: %s <input.txt> <output.hapticbank>\n", argv[0]);
+		return 1;
+	}
+
+	std::ifstream input(argv[1]);
+	if (!input.is_open())
+	{
+		fprintf(stderr, "ERROR: Could not open %s\n", argv[1]);
+		return 1;
+	}
+
+	std::vector<BankEntry> entries;
+	std::vector<uint8_t> samples;
+
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(input, line))
+	{
+		lineNumber++;
+
+		size_t comment = line.find('#');
+		if (comment != std::string::npos)
+			line.erase(comment);
+
+		std::istringstream fields(line);
+		std::string name;
+		if (!(fields >> name))
+			continue;  // Blank / comment line
+
+		if (name.size() >= kNameLength)
+		{
+			fprintf(stderr, "ERROR: %s:%d: pattern name '%s' longer than %d characters\n", argv[1], lineNumber, name.c_str(), kNameLength - 1);
+			return 1;
+		}
+
+		for (const BankEntry& existing : entries)
+		{
+			if (name == existing.name)
+			{
+				fprintf(stderr, "ERROR: %s:%d: duplicate pattern '%s'\n", argv[1], lineNumber, name.c_str());
+				return 1;
+			}
+		}
+
+		float duration = 0.0f;
+		if (!(fields >> duration) || duration < 0.0f)
+		{
+			fprintf(stderr, "ERROR: %s:%d: pattern '%s' needs a duration in seconds >= 0\n", argv[1], lineNumber, name.c_str());
+			return 1;
+		}
+
+		BankEntry entry = {};
+		strncpy(entry.name, name.c_str(), kNameLength - 1);
+		entry.sampleOffset = static_cast<uint32_t>(samples.size());
+		entry.durationSeconds = duration;
+
+		float strength;
+		while (fields >> strength)
+		{
+			if (strength < 0.0f) strength = 0.0f;
+			if (strength > 1.0f) strength = 1.0f;
+			samples.push_back(static_cast<uint8_t>(std::lround(strength * 255.0f)));
+			entry.sampleCount++;
+		}
+
+		if (!fields.eof())
+		{
+			fprintf(stderr, "ERROR: %s:%d: pattern '%s' has a non-numeric sample\n", argv[1], lineNumber, name.c_str());
+			return 1;
+		}
+		if (entry.sampleCount == 0)
+		{
+			fprintf(stderr, "ERROR: %s:%d: pattern '%s' has no samples\n", argv[1], lineNumber, name.c_str());
+			return 1;
+		}
+
+		entries.push_back(entry);
+		printf("%-24s %3u samples over %.3fs\n", entry.name, entry.sampleCount, entry.durationSeconds);
+	}
+
+	BankHeader header;
+	header.magic = kBankMagic;
+	header.version = kBankVersion;
+	header.patternCount = static_cast<uint32_t>(entries.size());
+	header.sampleBytes = static_cast<uint32_t>(samples.size());
+
+	std::ofstream output(argv[2], std::ios::binary | std::ios::trunc);
+	if (!output.is_open())
+	{
+		fprintf(stderr, "ERROR: Could not write %s\n", argv[2]);
+		return 1;
+	}
+
+	output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (!entries.empty())
+		output.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(BankEntry));
+	if (!samples.empty())
+		output.write(reinterpret_cast<const char*>(samples.data()), samples.size());
+
+	if (!output.good())
+	{
+		fprintf(stderr, "ERROR: Failed writing %s\n", argv[2]);
+		return 1;
+	}
+
+	printf("Wrote %s: %u patterns, %u sample bytes\n", argv[2], header.patternCount, header.sampleBytes);
+	return 0;
+}
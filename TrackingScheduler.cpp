@@ -0,0 +1,264 @@
+#include "TrackingScheduler.h"
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// TrackingScheduler Implementation
+	// ============================================
+
+	TrackingScheduler::TrackingScheduler()
+		: m_threadRunning(false)
+		, m_active(false)
+		, m_paused(false)
+		, m_tickPending(false)
+		, m_resync(true)
+		, m_intervalMs(100)
+		, m_clockPolicy(ClockPolicy::Skip)
+		, m_callback(nullptr)
+		, m_catchUpCredit(0)
+		, m_issuedDeadline(0)
+		, m_ticksIssued(0)
+		, m_ticksMissed(0)
+		, m_deadlinesSkipped(0)
+		, m_ticksCaughtUp(0)
+		, m_periodResync(true)
+	{
+	}
+
+	TrackingScheduler::~TrackingScheduler()
+	{
+		Shutdown();
+	}
+
+	void TrackingScheduler::Start(TickCallback callback, int intervalMs)
+	{
+		{
+			std::scoped_lock lock(m_lock);
+			m_callback = callback;
+			m_intervalMs = intervalMs > 0 ? intervalMs : 1;
+			m_tickPending = false;
+			m_paused = false;
+			m_active = true;
+			m_resync = true;
+			m_periodResync = true;
+		}
+
+		if (!m_threadRunning)
+		{
+			m_threadRunning = true;
+			m_thread = std::thread(&TrackingScheduler::Loop, this);
+			_MESSAGE("[TrackingScheduler] Scheduler thread started (interval: %d ms)", m_intervalMs.load());
+		}
+		else
+		{
+			m_wakeup.notify_all();
+		}
+	}
+
+	void TrackingScheduler::Stop()
+	{
+		{
+			std::scoped_lock lock(m_lock);
+			m_active = false;
+			m_paused = false;
+		}
+		m_wakeup.notify_all();
+	}
+
+	void TrackingScheduler::Pause()
+	{
+		{
+			std::scoped_lock lock(m_lock);
+			m_paused = true;
+		}
+		m_wakeup.notify_all();
+	}
+
+	void TrackingScheduler::Resume()
+	{
+		{
+			std::scoped_lock lock(m_lock);
+			m_paused = false;
+			m_resync = true;
+			m_periodResync = true;
+		}
+		m_wakeup.notify_all();
+	}
+
+	void TrackingScheduler::Shutdown()
+	{
+		if (!m_threadRunning)
+			return;
+
+		{
+			std::scoped_lock lock(m_lock);
+			m_threadRunning = false;
+			m_active = false;
+		}
+		m_wakeup.notify_all();
+
+		if (m_thread.joinable())
+		{
+			m_thread.join();
+		}
+		_MESSAGE("[TrackingScheduler] Scheduler thread stopped (issued: %llu, missed: %llu, skipped deadlines: %llu)",
+			m_ticksIssued.load(), m_ticksMissed.load(), m_deadlinesSkipped.load());
+	}
+
+	void TrackingScheduler::OnTickRun()
+	{
+		auto now = std::chrono::steady_clock::now();
+		std::chrono::steady_clock::time_point deadline{ std::chrono::steady_clock::duration(m_issuedDeadline.load()) };
+
+		m_lateness.Record(std::chrono::duration_cast<std::chrono::microseconds>(now - deadline).count());
+
+		if (m_periodResync)
+		{
+			m_periodResync = false;
+		}
+		else
+		{
+			m_period.Record(std::chrono::duration_cast<std::chrono::microseconds>(now - m_lastRunTime).count());
+		}
+		m_lastRunTime = now;
+	}
+
+	void TrackingScheduler::OnTickComplete()
+	{
+		bool owed;
+		{
+			std::scoped_lock lock(m_lock);
+			m_tickPending = false;
+			owed = m_catchUpCredit > 0;
+		}
+
+		// Owed deadlines go out right away instead of waiting for the next grid point
+		if (owed)
+		{
+			m_wakeup.notify_all();
+		}
+	}
+
+	void TrackingScheduler::SetIntervalMs(int intervalMs)
+	{
+		{
+			std::scoped_lock lock(m_lock);
+			m_intervalMs = intervalMs > 0 ? intervalMs : 1;
+			m_resync = true;
+		}
+		m_wakeup.notify_all();
+	}
+
+	void TrackingScheduler::ResetTimingStats()
+	{
+		m_lateness.Reset();
+		m_period.Reset();
+		m_periodResync = true;
+	}
+
+	void TrackingScheduler::DumpTimingStats() const
+	{
+		_MESSAGE("[TrackingScheduler] Interval: %d ms, policy: %s, issued: %llu (caught up: %llu), missed: %llu, skipped deadlines: %llu",
+			m_intervalMs.load(), m_clockPolicy == ClockPolicy::CatchUp ? "CATCH-UP" : "SKIP",
+			m_ticksIssued.load(), m_ticksCaughtUp.load(), m_ticksMissed.load(), m_deadlinesSkipped.load());
+		m_lateness.Dump("[TrackingScheduler]", "Lateness");
+		m_period.Dump("[TrackingScheduler]", "Period");
+	}
+
+	void TrackingScheduler::IssueTick(std::unique_lock<std::mutex>& lock, std::chrono::steady_clock::time_point deadline)
+	{
+		TickCallback callback = m_callback;
+		if (!callback)
+			return;
+
+		m_tickPending = true;
+		m_issuedDeadline = deadline.time_since_epoch().count();
+		++m_ticksIssued;
+
+		// Release the lock while handing off so Stop/Pause never block on the task queue
+		lock.unlock();
+		callback();
+		lock.lock();
+	}
+
+	void TrackingScheduler::Loop()
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		std::chrono::steady_clock::time_point nextDeadline = std::chrono::steady_clock::now();
+		std::chrono::steady_clock::time_point lastDeadline = nextDeadline;
+
+		while (m_threadRunning)
+		{
+			// Park while stopped or paused - no wakeups at all in this state
+			if (!m_active || m_paused)
+			{
+				m_catchUpCredit = 0;
+				m_wakeup.wait(lock, [this]() { return !m_threadRunning || (m_active && !m_paused); });
+				continue;
+			}
+
+			std::chrono::milliseconds interval(m_intervalMs.load());
+
+			// (Re)start the grid one interval from now
+			if (m_resync)
+			{
+				m_resync = false;
+				m_catchUpCredit = 0;
+				nextDeadline = std::chrono::steady_clock::now() + interval;
+			}
+
+			// Owed deadline and the previous tick has run - issue it back-to-back
+			if (CanCatchUp())
+			{
+				--m_catchUpCredit;
+				++m_ticksCaughtUp;
+				IssueTick(lock, lastDeadline);
+				continue;
+			}
+
+			// Sleep until the deadline, abandoning the wait if we get stopped/paused/realigned in the
+			// meantime or an owed tick can go out
+			if (m_wakeup.wait_until(lock, nextDeadline, [this]() { return ShouldWake() || CanCatchUp(); }))
+				continue;
+
+			std::chrono::steady_clock::time_point deadline = nextDeadline;
+			lastDeadline = deadline;
+			nextDeadline += interval;
+
+			// A full period or more behind the grid - realign to the first grid point still in the future
+			bool catchUp = (m_clockPolicy == ClockPolicy::CatchUp);
+			auto now = std::chrono::steady_clock::now();
+			if (now >= nextDeadline)
+			{
+				long long behind = (now - deadline) / interval;
+				nextDeadline = deadline + interval * (behind + 1);
+
+				// CatchUp owes the passed deadlines (within the credit limit); Skip drops them
+				long long owed = 0;
+				if (catchUp && m_catchUpCredit + behind <= MAX_CATCH_UP_TICKS)
+				{
+					owed = behind;
+					m_catchUpCredit += static_cast<int>(behind);
+				}
+				m_deadlinesSkipped += behind - owed;
+			}
+
+			// Previous tick has not run on the game thread yet - don't pile up work
+			if (m_tickPending)
+			{
+				// CatchUp owes this deadline and issues it once the previous tick completes
+				if (catchUp && m_catchUpCredit < MAX_CATCH_UP_TICKS)
+				{
+					++m_catchUpCredit;
+				}
+				else
+				{
+					++m_ticksMissed;
+				}
+				continue;
+			}
+
+			IssueTick(lock, deadline);
+		}
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "TimingHistogram.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Tracking Scheduler
+	// One long-lived thread that owns the VR tracking cadence.
+	// Ticks fall on a fixed deadline grid (start + N * interval), so the period
+	// does not stretch by the update time or the task queue delay.
+	// Never issues a new tick while the previous one is still pending.
+	// ============================================
+
+	// What to do when the scheduler falls a full period or more behind its grid
+	enum class ClockPolicy
+	{
+		Skip = 0,     // Drop the missed deadlines and realign to the next grid point
+		CatchUp = 1   // Owe the missed deadlines and issue them back-to-back as soon as the previous tick has run
+	};
+
+	// Most deadlines CatchUp owes at once; beyond this it gives up and realigns like Skip
+	constexpr int MAX_CATCH_UP_TICKS = 3;
+
+	class TrackingScheduler
+	{
+	public:
+		// Called from the scheduler thread when a tick is due (should queue work on the game thread)
+		typedef void(*TickCallback)();
+
+		TrackingScheduler();
+		~TrackingScheduler();
+
+		// Start issuing ticks (creates the thread on first use)
+		void Start(TickCallback callback, int intervalMs);
+
+		// Stop issuing ticks (thread stays parked until the next Start)
+		void Stop();
+
+		// Pause/Resume ticks without losing the callback/interval
+		void Pause();
+		void Resume();
+
+		// Stop and join the scheduler thread
+		void Shutdown();
+
+		// Called from the game thread when the queued tick starts running (records lateness/period)
+		void OnTickRun();
+
+		// Called from the game thread once the queued tick has run
+		void OnTickComplete();
+
+		// Change the tick interval (realigns the deadline grid)
+		void SetIntervalMs(int intervalMs);
+		int GetIntervalMs() const { return m_intervalMs; }
+
+		// Behaviour when falling behind the deadline grid
+		void SetClockPolicy(ClockPolicy policy) { m_clockPolicy = policy; }
+		ClockPolicy GetClockPolicy() const { return m_clockPolicy; }
+
+		bool IsActive() const { return m_active && !m_paused; }
+
+		// Counters
+		UInt64 GetTicksIssued() const { return m_ticksIssued; }
+		UInt64 GetTicksMissed() const { return m_ticksMissed; }
+		UInt64 GetDeadlinesSkipped() const { return m_deadlinesSkipped; }
+		UInt64 GetTicksCaughtUp() const { return m_ticksCaughtUp; }
+
+		// Timing statistics (game thread only)
+		const TimingHistogram& GetLatenessHistogram() const { return m_lateness; }
+		const TimingHistogram& GetPeriodHistogram() const { return m_period; }
+		void ResetTimingStats();
+
+		// Write counters and lateness/period histograms to the log (game thread only)
+		void DumpTimingStats() const;
+
+	private:
+		void Loop();
+
+		// Mark a tick pending and hand it to the callback (lock held on entry and exit, released during the callback)
+		void IssueTick(std::unique_lock<std::mutex>& lock, std::chrono::steady_clock::time_point deadline);
+
+		// Predicate for the wait loops - true when the current wait should be abandoned
+		bool ShouldWake() const { return !m_threadRunning || !m_active || m_paused || m_resync; }
+
+		// True when an owed catch-up tick can go out now (m_lock held)
+		bool CanCatchUp() const { return m_catchUpCredit > 0 && !m_tickPending; }
+
+		std::thread m_thread;
+		std::mutex m_lock;
+		std::condition_variable m_wakeup;
+
+		std::atomic<bool> m_threadRunning;
+		std::atomic<bool> m_active;
+		std::atomic<bool> m_paused;
+		std::atomic<bool> m_tickPending;
+		std::atomic<bool> m_resync;  // Realign the deadline grid to "now" on the next loop
+		std::atomic<int> m_intervalMs;
+		std::atomic<ClockPolicy> m_clockPolicy;
+
+		TickCallback m_callback;
+
+		// Deadlines owed under CatchUp (at most MAX_CATCH_UP_TICKS, guarded by m_lock)
+		int m_catchUpCredit;
+
+		// Deadline of the tick currently handed to the game thread (steady_clock ticks)
+		std::atomic<long long> m_issuedDeadline;
+
+		std::atomic<UInt64> m_ticksIssued;
+		std::atomic<UInt64> m_ticksMissed;
+		std::atomic<UInt64> m_deadlinesSkipped;
+		std::atomic<UInt64> m_ticksCaughtUp;
+
+		// Game-thread timing state
+		TimingHistogram m_lateness;  // Tick run time minus its deadline
+		TimingHistogram m_period;    // Time between consecutive tick runs
+		std::chrono::steady_clock::time_point m_lastRunTime;
+		std::atomic<bool> m_periodResync;  // Next run starts a new period measurement (after start/resume)
+	};
+}
@@ -3,12 +3,14 @@
 #include "EquipState.h"
 #include "Haptics.h"
 #include "SmokingMechanics.h"
+#include "TaskPool.h"
 #include "config.h"
 #include "skse64/GameReferences.h"
 #include "skse64/GameObjects.h"
 #include "skse64/NiNodes.h"
 #include "skse64/PluginAPI.h"
 #include <cmath>
+#include <algorithm>
 #include <chrono>
 
 namespace InteractivePipeSmokingVR
@@ -68,19 +70,23 @@ namespace InteractivePipeSmokingVR
 	}
 
 	// ============================================
-	// Periodic Update Task - runs once, updates, then schedules next update after delay
+	// Periodic Update Task - queued by the tracking scheduler, runs one update on the game thread
 	// ============================================
-	class VRInputTrackerUpdateTask : public TaskDelegate
+	class VRInputTrackerUpdateTask : public PooledTaskDelegate
 	{
 	public:
 		virtual void Run() override
 		{
-			if (g_vrInputTracker && g_vrInputTracker->IsTracking())
+			if (g_vrInputTracker)
 			{
-				g_vrInputTracker->Update();
-				
-				// Schedule next update after a short delay (don't immediately re-queue)
-				g_vrInputTracker->ScheduleNextUpdate();
+				if (g_vrInputTracker->IsTracking())
+				{
+					g_vrInputTracker->OnUpdateTaskRun();
+					g_vrInputTracker->Update();
+				}
+
+				// Let the scheduler issue the next tick
+				g_vrInputTracker->OnUpdateTaskComplete();
 			}
 		}
 
@@ -90,6 +96,19 @@ namespace InteractivePipeSmokingVR
 		}
 	};
 
+	// Scheduler tick callback (runs on the scheduler thread) - hand the update to the game thread
+	static void QueueTrackerUpdateTask()
+	{
+		if (g_task)
+		{
+			g_task->AddTask(new VRInputTrackerUpdateTask());
+		}
+		else if (g_vrInputTracker)
+		{
+			g_vrInputTracker->OnUpdateTaskComplete();
+		}
+	}
+
 	// ============================================
 	// VR Input Tracker Implementation
 	// ============================================
@@ -98,18 +117,33 @@ namespace InteractivePipeSmokingVR
 		: m_isTracking(false)
 		, m_isPaused(false)
 		, m_isInitialized(false)
+		, m_frameLocked(false)
+		, m_adaptive(false)
+		, m_governorTier(GovernorTier::Frame)
+		, m_governedIntervalMs(0)
+		, m_governorFramesSkipped(0)
+		, m_nodeCacheHits(0)
+		, m_nodeCacheMisses(0)
+		, m_nodeCacheInvalidations(0)
 		, m_hmdPosition(0, 0, 0)
 		, m_faceTargetPosition(0, 0, 0)
 		, m_leftControllerPosition(0, 0, 0)
 		, m_rightControllerPosition(0, 0, 0)
 		, m_leftControllerUpVector(0, 0, 1)
 		, m_rightControllerUpVector(0, 0, 1)
+		, m_lipsZone(-1)
+		, m_prevLeftZoneMask(0)
+		, m_prevRightZoneMask(0)
 		, m_leftNearFace(false)
 		, m_rightNearFace(false)
 		, m_prevLeftNearFace(false)
 		, m_prevRightNearFace(false)
+		, m_leftEntryPredicted(false)
+		, m_rightEntryPredicted(false)
+		, m_predictedEntries(0)
+		, m_confirmedEntries(0)
+		, m_unconfirmedEntries(0)
 		, m_controllersTouching(false)
-		, m_prevControllersTouching(false)
 		, m_fireSpellLeftHand(false)
 		, m_fireSpellRightHand(false)
 		, m_prevFireSpellLeftHand(false)
@@ -122,24 +156,22 @@ namespace InteractivePipeSmokingVR
 		, m_unlitRolledSmokeInRightHand(false)
 		, m_litItemInLeftHand(false)
 		, m_litItemInRightHand(false)
-		, m_lightingConditionMet(false)
-		, m_prevLightingConditionMet(false)
-		, m_lightingTriggered(false)
-		, m_burningSoundStarted(false)
-		, m_herbPipeHandFlipped(false)
-		, m_prevHerbPipeHandFlipped(false)
-		, m_herbPipeFlippedLongEnough(false)
-		, m_herbPipeEmptiedTriggered(false)
+		, m_gestureInputs(0)
 		, m_smokeItemHandNearFace(false)
 		, m_prevSmokeItemHandNearFace(false)
 		, m_pendingNearClipRestore(false)
-		, m_updatePending(false)
-		, m_handSwapHapticTriggered(false)
-		, m_handSwapSecondHapticTriggered(false)
-		, m_handSwapConditionMet(false)
 		, m_grabbedItemNearSmokableHand(false)
 		, m_prevGrabbedItemNearSmokableHand(false)
 	{
+		for (int i = 0; i < static_cast<int>(GovernorTier::Count); i++)
+		{
+			m_governorTierUpdates[i] = 0;
+		}
+
+		// Order matches the handles in RefreshNodeCache
+		m_nodeResolver.AddTarget(kLeftHandName);
+		m_nodeResolver.AddTarget(kRightHandName);
+		m_nodeResolver.AddTarget(kHMDNodeName);
 	}
 
 	VRInputTracker::~VRInputTracker()
@@ -157,6 +189,9 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[VRInputTracker] Face zone offset: X=%.2f Y=%.2f Z=%.2f Radius=%.2f",
 			configFaceZoneOffsetX, configFaceZoneOffsetY, configFaceZoneOffsetZ, configFaceZoneRadius);
 		_MESSAGE("[VRInputTracker] Controller touch radius: %.2f", configControllerTouchRadius);
+		_MESSAGE("[VRInputTracker] Tracking mode: %s",
+			configTrackingMode == static_cast<int>(TrackingMode::Adaptive) ? "ADAPTIVE" :
+			configTrackingMode == static_cast<int>(TrackingMode::Frame) ? "FRAME-LOCKED" : "TIMER");
 	}
 
 	void VRInputTracker::Shutdown()
@@ -165,6 +200,7 @@ namespace InteractivePipeSmokingVR
 			return;
 
 		StopTracking();
+		m_scheduler.Shutdown();
 		m_isInitialized = false;
 		_MESSAGE("[VRInputTracker] Shutdown");
 	}
@@ -177,13 +213,27 @@ namespace InteractivePipeSmokingVR
 		m_isTracking = true;
 		m_isInitialized = true;  // Ensure initialized flag is set when starting
 		m_isPaused = false;
-		m_updatePending = false;
+		RefreshProximityRadii();
+		RefreshZones();
+		RefreshPositionFilters();
+		RefreshGestures();
+		m_proximity.Reset();
+		m_gestures.Reset();
+		m_gestureInputs = 0;
+		m_leftPositionFilter.Reset();
+		m_rightPositionFilter.Reset();
+		m_hmdPositionFilter.Reset();
+		m_leftPoseHistory.Clear();
+		m_rightPoseHistory.Clear();
+		m_hmdPoseHistory.Clear();
+		m_poseClockStart = std::chrono::steady_clock::now();
 		m_leftNearFace = false;
 		m_rightNearFace = false;
 		m_prevLeftNearFace = false;
 		m_prevRightNearFace = false;
+		m_leftEntryPredicted = false;
+		m_rightEntryPredicted = false;
 		m_controllersTouching = false;
-		m_prevControllersTouching = false;
 		m_controllersNearForPipeFilling = false;
 		m_controllersNearForSmokeRolling = false;
 		m_controllersNearForPipeLighting = false;
@@ -192,32 +242,23 @@ namespace InteractivePipeSmokingVR
 		m_fireSpellRightHand = false;
 		m_prevFireSpellLeftHand = false;
 		m_prevFireSpellRightHand = false;
-		m_lightingConditionMet = false;
-		m_prevLightingConditionMet = false;
-		m_lightingTriggered = false;
-		m_burningSoundStarted = false;
 		m_litItemInLeftHand = false;
 		m_litItemInRightHand = false;
-		m_herbPipeHandFlipped = false;
-		m_prevHerbPipeHandFlipped = false;
-		m_herbPipeFlippedLongEnough = false;
-		m_herbPipeEmptiedTriggered = false;
-		m_litPipeHandFlipped = false;
-		m_prevLitPipeHandFlipped = false;
-		m_litPipeFlippedLongEnough = false;
-		m_litPipeEmptiedTriggered = false;
 		m_smokeItemHandNearFace = false;
 		m_prevSmokeItemHandNearFace = false;
 		m_pendingNearClipRestore = false;
-		m_handSwapHapticTriggered = false;
-		m_handSwapSecondHapticTriggered = false;
-		m_handSwapConditionMet = false;
 		m_grabbedItemNearSmokableHand = false;
 		m_prevGrabbedItemNearSmokableHand = false;
 		_MESSAGE("[VRInputTracker] Started tracking");
 
-		// Queue the first update
-		ScheduleNextUpdate();
+		// The player's 3D may have been rebuilt while we weren't tracking
+		InvalidateNodeCache();
+
+		// Each tracking session gets its own timing stats
+		m_scheduler.ResetTimingStats();
+
+		// Timer mode hands the cadence to the scheduler thread, frame-locked mode runs from the HIGGS callback
+		RefreshTrackingMode();
 	}
 
 	void VRInputTracker::StopTracking()
@@ -227,8 +268,33 @@ namespace InteractivePipeSmokingVR
 
 		m_isTracking = false;
 		m_isPaused = false;
-		m_updatePending = false;
+		m_scheduler.Stop();
 		_MESSAGE("[VRInputTracker] Stopped tracking");
+
+		if (!m_frameLocked)
+		{
+			DumpTimingStats();
+		}
+		DumpNodeCacheStats();
+
+		if (logging >= LOGLEVEL_INFO)
+		{
+			DumpPoseHistory();
+		}
+
+		if (configPredictiveZoneEntry)
+		{
+			DumpPredictionStats();
+		}
+
+		if (m_adaptive)
+		{
+			_MESSAGE("[VRInputTracker] Governor updates - frame: %llu, mid: %llu, far: %llu (frames skipped: %llu)",
+				m_governorTierUpdates[static_cast<int>(GovernorTier::Frame)],
+				m_governorTierUpdates[static_cast<int>(GovernorTier::Mid)],
+				m_governorTierUpdates[static_cast<int>(GovernorTier::Far)],
+				m_governorFramesSkipped);
+		}
 	}
 
 	void VRInputTracker::PauseTracking()
@@ -237,6 +303,7 @@ namespace InteractivePipeSmokingVR
 			return;
 
 		m_isPaused = true;
+		m_scheduler.Pause();
 		_MESSAGE("[VRInputTracker] Paused tracking (menu open)");
 	}
 
@@ -248,84 +315,267 @@ namespace InteractivePipeSmokingVR
 		m_isPaused = false;
 		_MESSAGE("[VRInputTracker] Resumed tracking (menu closed)");
 
-		// Schedule an update to resume the tracking loop
-		ScheduleNextUpdate();
+		// Wake the scheduler to resume the tracking loop
+		m_scheduler.Resume();
+		RefreshTrackingMode();
 	}
 
-	void VRInputTracker::ScheduleNextUpdate()
+	void VRInputTracker::OnUpdateTaskRun()
 	{
-		// Prevent multiple pending updates
-		if (m_updatePending || !m_isTracking || m_isPaused)
-			return;
+		m_scheduler.OnTickRun();
+	}
 
-		m_updatePending = true;
+	void VRInputTracker::OnUpdateTaskComplete()
+	{
+		m_scheduler.OnTickComplete();
+	}
 
-		// Use a thread to delay then queue the task (avoids infinite task loop)
-		std::thread([this]() {
-			std::this_thread::sleep_for(std::chrono::milliseconds(100)); // 10 updates per second
-			
-			if (m_isTracking && !m_isPaused && g_task)
-			{
-				m_updatePending = false;
-				g_task->AddTask(new VRInputTrackerUpdateTask());
-			}
-			else
+	void VRInputTracker::DumpTimingStats() const
+	{
+		m_scheduler.DumpTimingStats();
+	}
+
+	void VRInputTracker::DumpPoseHistory() const
+	{
+		m_leftPoseHistory.Dump("LeftController");
+		m_rightPoseHistory.Dump("RightController");
+		m_hmdPoseHistory.Dump("HMD");
+	}
+
+	void VRInputTracker::DumpPredictionStats() const
+	{
+		_MESSAGE("[VRInputTracker] Predictive face entry - predicted: %llu, confirmed: %llu, unconfirmed: %llu",
+			m_predictedEntries, m_confirmedEntries, m_unconfirmedEntries);
+	}
+
+	void VRInputTracker::OnFrameUpdate()
+	{
+		// Timer mode is driven by the scheduler - nothing to do here
+		if (!m_frameLocked || !IsTracking())
+			return;
+
+		if (m_adaptive && m_governedIntervalMs > 0)
+		{
+			// Governor chose a slower rate - skip frames until the interval has elapsed
+			auto now = std::chrono::steady_clock::now();
+			auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastUpdateTime).count();
+			if (elapsedMs < m_governedIntervalMs)
 			{
-				m_updatePending = false;
+				++m_governorFramesSkipped;
+				return;
 			}
-		}).detach();
+		}
+
+		// Already on the game thread: sample poses and run the detectors directly
+		Update();
+
+		if (m_adaptive)
+		{
+			m_lastUpdateTime = std::chrono::steady_clock::now();
+			++m_governorTierUpdates[static_cast<int>(m_governorTier)];
+			UpdateRateGovernor();
+		}
 	}
 
-	NiAVObject* VRInputTracker::FindNodeByName(NiAVObject* root, const char* name)
+	void VRInputTracker::RefreshProximityRadii()
 	{
-		if (!root || !name)
-			return nullptr;
+		m_proximity.SetRadii(configControllerTouchRadius, configPipeFillingRadius, configSmokeRollingRadius,
+			configPipeLightingRadius, configRolledSmokeLightingRadius, configZoneHysteresis);
+	}
+
+	void VRInputTracker::RefreshPositionFilters()
+	{
+		m_leftPositionFilter.SetParameters(configPositionFilterMinCutoff, configPositionFilterBeta);
+		m_rightPositionFilter.SetParameters(configPositionFilterMinCutoff, configPositionFilterBeta);
+		m_hmdPositionFilter.SetParameters(configPositionFilterMinCutoff, configPositionFilterBeta);
+	}
+
+	void VRInputTracker::RefreshZones()
+	{
+		std::vector<ZoneDefinition> zones;
+
+		ZoneDefinition lips;
+		lips.name = ZONE_LIPS_NAME;
+		lips.anchor = ZoneAnchor::Head;
+		lips.shape = ZoneShape::Sphere;
+		lips.start.x = configFaceZoneOffsetX;
+		lips.start.y = configFaceZoneOffsetY;
+		lips.start.z = configFaceZoneOffsetZ;
+		lips.end = lips.start;
+		lips.radius = configFaceZoneRadius;
+		zones.push_back(lips);
+
+		zones.insert(zones.end(), configZones.begin(), configZones.end());
+
+		m_zones.Build(zones, configZoneHysteresis);
+		m_lipsZone = m_zones.FindZone(ZONE_LIPS_NAME);
+		m_prevLeftZoneMask = 0;
+		m_prevRightZoneMask = 0;
+	}
 
-		// Compare exact name
-		if (root->m_name && _stricmp(root->m_name, name) == 0)
-			return root;
+	bool VRInputTracker::IsControllerInZone(bool isLeft, const char* zoneName) const
+	{
+		return m_zones.IsControllerInZone(isLeft, m_zones.FindZone(zoneName));
+	}
 
-		NiNode* node = root->GetAsNiNode();
-		if (!node)
-			return nullptr;
+	void VRInputTracker::RefreshGestures()
+	{
+		const UInt32 nearFace = GestureInputBit(GestureInput::LeftNearFace) | GestureInputBit(GestureInput::RightNearFace);
+		const UInt32 touching = GestureInputBit(GestureInput::ControllersTouching);
+		const UInt32 fireSpell = GestureInputBit(GestureInput::FireSpell);
+		const UInt32 herbPipe = GestureInputBit(GestureInput::HerbPipe);
+
+		// One row per TrackerGesture: name, clauses { all, none }, start edge, stage delays
+		const GestureDefinition gestures[static_cast<int>(TrackerGesture::Count)] = {
+			{ "ControllersTouch", 1, { { touching, 0 } }, 0,
+				1, { configControllerTouchDurationMs } },
+			{ "HerbPipeFlip", 1, { { GestureInputBit(GestureInput::HerbPipeFlipped), 0 } }, 0,
+				1, { PIPE_FLIP_EMPTY_MS } },
+			{ "LitPipeFlip", 1, { { GestureInputBit(GestureInput::LitItemFlipped), 0 } }, 0,
+				1, { PIPE_FLIP_EMPTY_MS } },
+			// Herb pipes use the pipe lighting radius, rolled smokes the (larger) rolled smoke lighting radius
+			{ "Lighting", 2, {
+					{ fireSpell | herbPipe | GestureInputBit(GestureInput::PipeLightingRange), 0 },
+					{ fireSpell | GestureInputBit(GestureInput::UnlitRolledSmoke) | GestureInputBit(GestureInput::RolledSmokeLightingRange), herbPipe } }, 0,
+				2, { LIGHTING_SOUND_DELAY_MS, LIGHTING_TRIGGER_MS } },
+			// Only starts when the hands start touching, blocked while either hand is at the face
+			{ "HandSwap", 1, { { touching | GestureInputBit(GestureInput::SmokableInOneHand) | GestureInputBit(GestureInput::OtherHandFree), nearFace } }, touching,
+				3, { 0, HAND_SWAP_SECOND_PULSE_MS, HAND_SWAP_TRIGGER_MS } }
+		};
+
+		m_gestures.SetGestures(gestures, static_cast<int>(TrackerGesture::Count));
+	}
 
-		for (UInt32 i = 0; i < node->m_children.m_size; ++i)
+	void VRInputTracker::RefreshTrackingMode()
+	{
+		bool adaptive = (configTrackingMode == static_cast<int>(TrackingMode::Adaptive));
+		bool frameLocked = adaptive || (configTrackingMode == static_cast<int>(TrackingMode::Frame));
+
+		// Frame-locked modes are driven by the HIGGS post-update callback - without HIGGS nothing would call Update
+		if (frameLocked && !higgsInterface)
 		{
-			NiAVObject* child = node->m_children.m_data[i];
-			if (!child)
-				continue;
-			if (NiAVObject* found = FindNodeByName(child, name))
-				return found;
+			static bool fallbackLogged = false;
+			if (!fallbackLogged)
+			{
+				_MESSAGE("[VRInputTracker] TrackingMode=%d needs HIGGS (not available) - falling back to TIMER", configTrackingMode);
+				fallbackLogged = true;
+			}
+			frameLocked = false;
+			adaptive = false;
 		}
 
-		return nullptr;
+		if (frameLocked != m_frameLocked || adaptive != m_adaptive)
+		{
+			_MESSAGE("[VRInputTracker] Tracking mode changed to %s", adaptive ? "ADAPTIVE" : frameLocked ? "FRAME-LOCKED" : "TIMER");
+			m_frameLocked = frameLocked;
+			m_adaptive = adaptive;
+
+			// Start the governor at full rate - the first update picks the real tier
+			m_governorTier = GovernorTier::Frame;
+			m_governedIntervalMs = 0;
+		}
+
+		if (!m_isTracking)
+			return;
+
+		if (m_frameLocked)
+		{
+			// Per-frame callback owns the cadence - park the scheduler thread
+			m_scheduler.Stop();
+		}
+		else if (!m_isPaused && !m_scheduler.IsActive())
+		{
+			// Hand the cadence to the scheduler thread (created once, reused across start/stop)
+			m_scheduler.SetClockPolicy(configTrackingClockPolicy == static_cast<int>(ClockPolicy::CatchUp) ? ClockPolicy::CatchUp : ClockPolicy::Skip);
+			m_scheduler.Start(QueueTrackerUpdateTask, TRACKING_UPDATE_INTERVAL_MS);
+		}
 	}
 
-	NiAVObject* VRInputTracker::GetPlayerHandNode(bool rightHand)
+	NiNode* VRInputTracker::ValidateNodeCache()
 	{
-		if (!g_thePlayer || !(*g_thePlayer))
-			return nullptr;
+		NiNode* root = nullptr;
+		if (g_thePlayer && *g_thePlayer)
+		{
+			TESObjectREFR* playerRefr = *g_thePlayer;
+			root = playerRefr->GetNiNode();
+		}
+
+		// A new root means the player's 3D was rebuilt - every cached node belongs to the old skeleton.
+		// Holding a reference to the old root keeps its address from being reused by the new one.
+		if (root != m_cachedRoot)
+		{
+			if (m_cachedRoot)
+			{
+				InvalidateNodeCache();
+			}
+			m_cachedRoot = root;
+		}
 
-		TESObjectREFR* playerRefr = *g_thePlayer;
-		NiNode* root = playerRefr->GetNiNode();
+		return root;
+	}
+
+	void VRInputTracker::RefreshNodeCache()
+	{
+		NiNode* root = ValidateNodeCache();
 		if (!root)
-			return nullptr;
+			return;
 
-		const char* nodeName = rightHand ? kRightHandName : kLeftHandName;
-		return FindNodeByName(root, nodeName);
+		// Same order as the resolver targets added in the constructor
+		NiPointer<NiAVObject>* handles[] = { &m_cachedLeftHand, &m_cachedRightHand, &m_cachedHMD };
+		const int handleCount = static_cast<int>(sizeof(handles) / sizeof(handles[0]));
+
+		// Handles still attached to the skeleton are reused; only the rest are searched for
+		NiAVObject* results[SCENE_RESOLVER_MAX_TARGETS] = {};
+		int stale = 0;
+		for (int i = 0; i < handleCount; i++)
+		{
+			NiPointer<NiAVObject>& handle = *handles[i];
+			if (handle && handle->m_parent)
+			{
+				results[i] = handle;
+				m_nodeCacheHits++;
+			}
+			else
+			{
+				stale++;
+			}
+		}
+
+		if (stale == 0)
+			return;
+
+		m_nodeCacheMisses += stale;
+
+		NiAVObject* roots[] = { root };
+		m_nodeResolver.Resolve(roots, 1, results);
+
+		for (int i = 0; i < handleCount; i++)
+		{
+			if (*handles[i] != results[i])
+			{
+				*handles[i] = results[i];
+			}
+		}
 	}
 
-	NiAVObject* VRInputTracker::GetPlayerHMDNode()
+	void VRInputTracker::InvalidateNodeCache()
 	{
-		if (!g_thePlayer || !(*g_thePlayer))
-			return nullptr;
+		if (m_cachedRoot || m_cachedLeftHand || m_cachedRightHand || m_cachedHMD)
+		{
+			m_nodeCacheInvalidations++;
+		}
 
-		TESObjectREFR* playerRefr = *g_thePlayer;
-		NiNode* root = playerRefr->GetNiNode();
-		if (!root)
-			return nullptr;
+		m_cachedRoot = nullptr;
+		m_cachedLeftHand = nullptr;
+		m_cachedRightHand = nullptr;
+		m_cachedHMD = nullptr;
+	}
 
-		return FindNodeByName(root, kHMDNodeName);
+	void VRInputTracker::DumpNodeCacheStats() const
+	{
+		_MESSAGE("[VRInputTracker] Node cache - hits: %llu, misses: %llu, invalidations: %llu (skeleton walks: %llu, nodes visited: %llu)",
+			m_nodeCacheHits, m_nodeCacheMisses, m_nodeCacheInvalidations,
+			m_nodeResolver.GetWalks(), m_nodeResolver.GetNodesVisited());
 	}
 
 	void VRInputTracker::Update()
@@ -336,42 +586,25 @@ namespace InteractivePipeSmokingVR
 		// NOTE: UpdateHeldSmokableScale is called from PostVrikPostHiggsCallback instead
 		// to ensure our scale is applied AFTER HIGGS processes the held object
 
-		// Get hand and head nodes
-		NiAVObject* leftHand = GetPlayerHandNode(false);
-		NiAVObject* rightHand = GetPlayerHandNode(true);
-		NiAVObject* hmdNode = GetPlayerHMDNode();
+		// Get hand and head nodes (cached - the skeleton is only searched after a 3D rebuild)
+		RefreshNodeCache();
+		NiAVObject* leftHand = m_cachedLeftHand;
+		NiAVObject* rightHand = m_cachedRightHand;
+		NiAVObject* hmdNode = m_cachedHMD;
+
+		// Sample time of this update (pose history and position filters)
+		double poseTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_poseClockStart).count();
 
-		// Update HMD position and calculate face target position with offset
+		// Update HMD position (jitter filtered)
 		if (hmdNode)
 		{
-			m_hmdPosition = hmdNode->m_worldTransform.pos;
-
-			// Get the head's rotation matrix to apply offsets in local space
-			NiMatrix33& headRot = hmdNode->m_worldTransform.rot;
-
-			// Calculate offset in world space using head's local coordinate system
-			// Local X = right, Local Y = forward (facing direction), Local Z = up
-			NiPoint3 localOffset;
-			localOffset.x = configFaceZoneOffsetX;
-			localOffset.y = configFaceZoneOffsetY;
-			localOffset.z = configFaceZoneOffsetZ;
-
-			// Transform local offset to world space using head rotation
-			NiPoint3 worldOffset;
-			worldOffset.x = headRot.data[0][0] * localOffset.x + headRot.data[0][1] * localOffset.y + headRot.data[0][2] * localOffset.z;
-			worldOffset.y = headRot.data[1][0] * localOffset.x + headRot.data[1][1] * localOffset.y + headRot.data[1][2] * localOffset.z;
-			worldOffset.z = headRot.data[2][0] * localOffset.x + headRot.data[2][1] * localOffset.y + headRot.data[2][2] * localOffset.z;
-
-			// Face target is HMD position plus the rotated offset
-			m_faceTargetPosition.x = m_hmdPosition.x + worldOffset.x;
-			m_faceTargetPosition.y = m_hmdPosition.y + worldOffset.y;
-			m_faceTargetPosition.z = m_hmdPosition.z + worldOffset.z;
+			m_hmdPosition = m_hmdPositionFilter.Filter(poseTime, hmdNode->m_worldTransform.pos);
 		}
 
 		// Update left controller position and rotation
 		if (leftHand)
 		{
-			m_leftControllerPosition = leftHand->m_worldTransform.pos;
+			m_leftControllerPosition = m_leftPositionFilter.Filter(poseTime, leftHand->m_worldTransform.pos);
 			
 			// Extract the "up" vector from the rotation matrix (Z column in local space)
 			// This tells us which way the controller's "up" is pointing in world space
@@ -384,7 +617,7 @@ namespace InteractivePipeSmokingVR
 		// Update right controller position and rotation
 		if (rightHand)
 		{
-			m_rightControllerPosition = rightHand->m_worldTransform.pos;
+			m_rightControllerPosition = m_rightPositionFilter.Filter(poseTime, rightHand->m_worldTransform.pos);
 			
 			// Extract the "up" vector from the rotation matrix (Z column in local space)
 			// This tells us which way the controller's "up" is pointing in world space
@@ -394,15 +627,51 @@ namespace InteractivePipeSmokingVR
 			m_rightControllerUpVector.z = rightRot.data[2][2];
 		}
 
+		// Record the poses (velocity and acceleration are updated incrementally)
+		if (leftHand)
+		{
+			m_leftPoseHistory.Push(poseTime, m_leftControllerPosition, m_leftControllerUpVector);
+		}
+		if (rightHand)
+		{
+			m_rightPoseHistory.Push(poseTime, m_rightControllerPosition, m_rightControllerUpVector);
+		}
+		if (hmdNode)
+		{
+			NiMatrix33& headRot = hmdNode->m_worldTransform.rot;
+			NiPoint3 headUp(headRot.data[0][2], headRot.data[1][2], headRot.data[2][2]);
+			m_hmdPoseHistory.Push(poseTime, m_hmdPosition, headUp);
+		}
+
+		// Transform the head/body zones and test both controllers against all of them in one pass
+		// (the head anchor uses the filtered HMD position)
+		NiNode* root = m_cachedRoot;
+		NiTransform headTransform;
+		if (hmdNode)
+		{
+			headTransform = hmdNode->m_worldTransform;
+			headTransform.pos = m_hmdPosition;
+		}
+		const NiTransform* zoneAnchors[static_cast<int>(ZoneAnchor::Count)] = {
+			hmdNode ? &headTransform : nullptr,
+			root ? &root->m_worldTransform : nullptr
+		};
+		m_zones.Evaluate(zoneAnchors, m_leftControllerPosition, m_rightControllerPosition);
+		UpdateZoneTransitions();
+
+		// Face target is the lips zone center (HMD position plus the head-rotated FaceZone offset)
+		m_zones.GetZoneWorldCenter(m_lipsZone, m_faceTargetPosition);
+
+		// Evaluate every hand-to-hand radius against the new positions in one pass
+		m_proximity.SetPoints(m_leftControllerPosition, m_rightControllerPosition);
+		m_proximity.Evaluate();
+
 		// Update all detections
 		UpdateNearFaceDetection();
 		UpdateControllersTouchingDetection();
 		UpdateFireSpellDetection();
 		UpdateNearClipForSmokeItem();
-		UpdateHerbPipeRotationDetection();
-		UpdateLitPipeRotationDetection();
-		UpdateLightingConditionDetection();
-		UpdateHandSwapDetection();
+		UpdateGestures();
 		UpdateGrabbedItemNearSmokableHandDetection();
 
 		// Update smoking mechanics (inhale detection for lit items)
@@ -427,6 +696,79 @@ namespace InteractivePipeSmokingVR
 		return std::sqrt(dx * dx + dy * dy + dz * dz);
 	}
 
+	bool VRInputTracker::IsAnyDetectionTimerRunning() const
+	{
+		return m_gestures.GetActiveMask() != 0
+			|| m_pendingNearClipRestore
+			|| IsInhaling();
+	}
+
+	void VRInputTracker::UpdateRateGovernor()
+	{
+		GovernorTier tier = GovernorTier::Far;
+
+		if (IsAnyDetectionTimerRunning())
+		{
+			// Hold durations are measured on the update grid - keep it tight while one is running
+			tier = GovernorTier::Frame;
+		}
+		else
+		{
+			// Closest face zone boundary (entering or leaving)
+			float margin = std::fabs(GetLeftControllerToFaceDistance() - configFaceZoneRadius);
+			margin = (std::min)(margin, std::fabs(GetRightControllerToFaceDistance() - configFaceZoneRadius));
+
+			// Closest hand-to-hand boundary
+			float controllerDistance = GetControllerToControllerDistance();
+			const float handRadii[] = {
+				configControllerTouchRadius,
+				configPipeFillingRadius,
+				configSmokeRollingRadius,
+				configPipeLightingRadius,
+				configRolledSmokeLightingRadius
+			};
+			for (float radius : handRadii)
+			{
+				margin = (std::min)(margin, std::fabs(controllerDistance - radius));
+			}
+
+			if (margin <= GOVERNOR_NEAR_MARGIN)
+			{
+				tier = GovernorTier::Frame;
+			}
+			else if (margin <= GOVERNOR_FAR_MARGIN)
+			{
+				tier = GovernorTier::Mid;
+			}
+
+			// A held pipe tilting towards the flip threshold needs full rate too
+			if (tier != GovernorTier::Frame)
+			{
+				bool leftPipe = m_herbPipeInLeftHand || m_litItemInLeftHand;
+				bool rightPipe = m_herbPipeInRightHand || m_litItemInRightHand;
+				if ((leftPipe && m_leftControllerUpVector.z < GOVERNOR_FLIP_SAFE_UP_Z) ||
+					(rightPipe && m_rightControllerUpVector.z < GOVERNOR_FLIP_SAFE_UP_Z))
+				{
+					tier = GovernorTier::Frame;
+				}
+			}
+		}
+
+		m_governorTier = tier;
+		switch (tier)
+		{
+		case GovernorTier::Frame:
+			m_governedIntervalMs = 0;
+			break;
+		case GovernorTier::Mid:
+			m_governedIntervalMs = GOVERNOR_MID_INTERVAL_MS;
+			break;
+		default:
+			m_governedIntervalMs = GOVERNOR_FAR_INTERVAL_MS;
+			break;
+		}
+	}
+
 	float VRInputTracker::GetLeftControllerToFaceDistance() const
 	{
 		return CalculateDistance(m_leftControllerPosition, m_faceTargetPosition);
@@ -442,19 +784,117 @@ namespace InteractivePipeSmokingVR
 		return CalculateDistance(m_leftControllerPosition, m_rightControllerPosition);
 	}
 
+	void VRInputTracker::UpdateZoneTransitions()
+	{
+		UInt32 leftMask = m_zones.GetLeftMask();
+		UInt32 rightMask = m_zones.GetRightMask();
+
+		// Log entering/leaving INI zones (the lips zone has its own detection)
+		UInt32 changed[2] = { leftMask ^ m_prevLeftZoneMask, rightMask ^ m_prevRightZoneMask };
+		UInt32 current[2] = { leftMask, rightMask };
+		for (int hand = 0; hand < 2; hand++)
+		{
+			for (int i = 0; i < m_zones.GetZoneCount(); i++)
+			{
+				UInt32 bit = 1u << i;
+				if (i == m_lipsZone || !(changed[hand] & bit))
+					continue;
+
+				_MESSAGE("[Zones] %s controller %s zone '%s'", hand == 0 ? "LEFT" : "RIGHT",
+					(current[hand] & bit) ? "ENTERED" : "LEFT", m_zones.GetZoneName(i));
+			}
+		}
+
+		m_prevLeftZoneMask = leftMask;
+		m_prevRightZoneMask = rightMask;
+	}
+
+	float VRInputTracker::GetPredictionLookAheadSeconds() const
+	{
+		int lookAheadMs = configPredictiveLookAheadMs;
+		if (lookAheadMs <= 0)
+		{
+			// The latency to hide is the time until the next update - use the last measured interval
+			const PoseHistory& history = m_hmdPoseHistory;
+			if (history.GetCount() < 2)
+				return 0.0f;
+			double interval = history.GetSample(0).time - history.GetSample(1).time;
+			lookAheadMs = static_cast<int>(interval * 1000.0 + 0.5);
+		}
+
+		lookAheadMs = (std::min)(lookAheadMs, PREDICTION_MAX_LOOKAHEAD_MS);
+		return lookAheadMs / 1000.0f;
+	}
+
+	bool VRInputTracker::IsFaceZoneEntryPredicted(bool isLeft, float lookAhead) const
+	{
+		const PoseHistory& hand = GetControllerPoseHistory(isLeft);
+		if (lookAhead <= 0.0f || hand.IsEmpty() || m_hmdPoseHistory.IsEmpty())
+			return false;
+
+		// Motion relative to the head - the face target moves with it
+		NiPoint3 handVelocity = hand.GetVelocity();
+		NiPoint3 headVelocity = m_hmdPoseHistory.GetVelocity();
+		NiPoint3 relativeVelocity(handVelocity.x - headVelocity.x, handVelocity.y - headVelocity.y, handVelocity.z - headVelocity.z);
+
+		const NiPoint3& position = isLeft ? m_leftControllerPosition : m_rightControllerPosition;
+		NiPoint3 toFace(m_faceTargetPosition.x - position.x, m_faceTargetPosition.y - position.y, m_faceTargetPosition.z - position.z);
+
+		// Only a hand moving towards the face
+		if (relativeVelocity.x * toFace.x + relativeVelocity.y * toFace.y + relativeVelocity.z * toFace.z <= 0.0f)
+			return false;
+
+		float dx = toFace.x - relativeVelocity.x * lookAhead;
+		float dy = toFace.y - relativeVelocity.y * lookAhead;
+		float dz = toFace.z - relativeVelocity.z * lookAhead;
+		return (dx * dx + dy * dy + dz * dz) <= configFaceZoneRadius * configFaceZoneRadius;
+	}
+
+	void VRInputTracker::ApplyPredictedEntry(bool isLeft, bool& nearFace, bool& entryPredicted, float lookAhead)
+	{
+		if (nearFace)
+		{
+			// Actually inside - a standing prediction came true
+			if (entryPredicted)
+			{
+				m_confirmedEntries++;
+				entryPredicted = false;
+			}
+			return;
+		}
+
+		bool predicted = IsFaceZoneEntryPredicted(isLeft, lookAhead);
+		if (predicted && !entryPredicted)
+		{
+			m_predictedEntries++;
+		}
+		else if (!predicted && entryPredicted)
+		{
+			// Hand stopped or turned away before reaching the zone
+			m_unconfirmedEntries++;
+		}
+
+		entryPredicted = predicted;
+		nearFace = predicted;
+	}
+
 	void VRInputTracker::UpdateNearFaceDetection()
 	{
 		// Store previous state
 		m_prevLeftNearFace = m_leftNearFace;
 		m_prevRightNearFace = m_rightNearFace;
 
-		// Calculate distances to the face target position (offset from HMD)
-		float leftDistance = GetLeftControllerToFaceDistance();
-		float rightDistance = GetRightControllerToFaceDistance();
+		// Face zone membership is the Lips zone (configurable radius around the face target, offset from HMD)
+		m_leftNearFace = m_zones.IsControllerInZone(true, m_lipsZone);
+		m_rightNearFace = m_zones.IsControllerInZone(false, m_lipsZone);
 
-		// Use configurable radius
-		m_leftNearFace = (leftDistance <= configFaceZoneRadius);
-		m_rightNearFace = (rightDistance <= configFaceZoneRadius);
+		// Optionally count a hand about to enter as already inside
+		if (configPredictiveZoneEntry)
+		{
+			float lookAhead = GetPredictionLookAheadSeconds();
+			ApplyPredictedEntry(true, m_leftNearFace, m_leftEntryPredicted, lookAhead);
+			ApplyPredictedEntry(false, m_rightNearFace, m_rightEntryPredicted, lookAhead);
+		}
 
 		// Log state changes for left controller
 		if (m_leftNearFace && !m_prevLeftNearFace)
@@ -478,15 +918,9 @@ namespace InteractivePipeSmokingVR
 
 	void VRInputTracker::UpdateControllersTouchingDetection()
 	{
-		// Store previous state
-		m_prevControllersTouching = m_controllersTouching;
-
-		// Calculate distance between controllers
-		float controllerDistance = GetControllerToControllerDistance();
-
 		// Use larger radius for rolled smoke lighting with fire spell
 		// This only affects the lighting detection - other actions (pipe filling, smoke rolling) use normal radius
-		float effectiveRadius = configControllerTouchRadius;
+		ProximityZone touchZone = ProximityZone::ControllersTouch;
 		
 		bool hasUnlitRolledSmoke = m_unlitRolledSmokeInLeftHand || m_unlitRolledSmokeInRightHand;
 		bool hasFireSpell = m_fireSpellLeftHand || m_fireSpellRightHand;
@@ -494,52 +928,23 @@ namespace InteractivePipeSmokingVR
 		if (hasUnlitRolledSmoke && hasFireSpell)
 		{
 			// Use larger radius for rolled smoke lighting
-			effectiveRadius = configRolledSmokeLightingRadius;
+			touchZone = ProximityZone::RolledSmokeLighting;
 		}
 
-		m_controllersTouching = (controllerDistance <= effectiveRadius);
-
-		// Separate check for pipe filling with its own radius
-		m_controllersNearForPipeFilling = (controllerDistance <= configPipeFillingRadius);
-
-		// Separate check for smoke rolling with its own radius
-		m_controllersNearForSmokeRolling = (controllerDistance <= configSmokeRollingRadius);
-
-		// Separate check for pipe lighting with its own radius
-		m_controllersNearForPipeLighting = (controllerDistance <= configPipeLightingRadius);
+		m_controllersTouching = m_proximity.IsInZone(touchZone);
 
-		// Separate check for rolled smoke lighting with its own (larger) radius
-		m_controllersNearForRolledSmokeLighting = (controllerDistance <= configRolledSmokeLightingRadius);
+		// Separate checks, each with its own radius
+		m_controllersNearForPipeFilling = m_proximity.IsInZone(ProximityZone::PipeFilling);
+		m_controllersNearForSmokeRolling = m_proximity.IsInZone(ProximityZone::SmokeRolling);
+		m_controllersNearForPipeLighting = m_proximity.IsInZone(ProximityZone::PipeLighting);
+		m_controllersNearForRolledSmokeLighting = m_proximity.IsInZone(ProximityZone::RolledSmokeLighting);
 
-		// Log when controllers start/stop touching
-		if (m_controllersTouching && !m_prevControllersTouching)
-		{
-			m_controllersTouchStartTime = std::chrono::steady_clock::now();
-		}
-		else if (!m_controllersTouching && m_prevControllersTouching)
-		{
-			// Reset the global flag when controllers stop touching
-		 g_controllersTouchingLongEnough = false;
-		}
-		// Update global flag for controllers touching long enough
-		if (m_controllersTouching)
-		{
-			int touchDurationMs = GetControllersTouchingDurationMs();
-			if (touchDurationMs >= configControllerTouchDurationMs && !g_controllersTouchingLongEnough)
-			{
-				g_controllersTouchingLongEnough = true;
-			}
-		}
+		// How long they have been touching is tracked by the ControllersTouch gesture
 	}
 
 	int VRInputTracker::GetControllersTouchingDurationMs() const
 	{
-		if (!m_controllersTouching)
-			return 0;
-
-		auto now = std::chrono::steady_clock::now();
-		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_controllersTouchStartTime);
-		return static_cast<int>(duration.count());
+		return m_gestures.GetHeldMs(static_cast<int>(TrackerGesture::ControllersTouch));
 	}
 
 	void VRInputTracker::UpdateFireSpellDetection()
@@ -607,11 +1012,8 @@ namespace InteractivePipeSmokingVR
 		m_herbPipeInLeftHand = leftHand;
 		m_herbPipeInRightHand = rightHand;
 		
-		// Reset flipped state when herb pipe equip state changes
-		m_herbPipeHandFlipped = false;
-		m_prevHerbPipeHandFlipped = false;
-		m_herbPipeFlippedLongEnough = false;
-		m_herbPipeEmptiedTriggered = false;
+		// Restart the flip timer when herb pipe equip state changes
+		m_gestures.Restart(static_cast<int>(TrackerGesture::HerbPipeFlip));
 		
 		_MESSAGE("[VRInputTracker] Herb pipe equipped - Left: %d, Right: %d", leftHand ? 1 : 0, rightHand ? 1 : 0);
 	}
@@ -632,11 +1034,8 @@ namespace InteractivePipeSmokingVR
 		m_litItemInLeftHand = leftHand;
 		m_litItemInRightHand = rightHand;
 		
-		// Reset flipped state when lit item equip state changes
-		m_litPipeHandFlipped = false;
-		m_prevLitPipeHandFlipped = false;
-		m_litPipeFlippedLongEnough = false;
-		m_litPipeEmptiedTriggered = false;
+		// Restart the flip timer when lit item equip state changes
+		m_gestures.Restart(static_cast<int>(TrackerGesture::LitPipeFlip));
 		
 		_MESSAGE("[VRInputTracker] Lit item equipped - Left: %d, Right: %d", leftHand ? 1 : 0, rightHand ? 1 : 0);
 
@@ -649,12 +1048,7 @@ namespace InteractivePipeSmokingVR
 
 	int VRInputTracker::GetLightingConditionDurationMs() const
 	{
-		if (!m_lightingConditionMet)
-			return 0;
-
-		auto now = std::chrono::steady_clock::now();
-		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lightingConditionStartTime);
-		return static_cast<int>(duration.count());
+		return m_gestures.GetHeldMs(static_cast<int>(TrackerGesture::Lighting));
 	}
 
 	void VRInputTracker::ForceRestoreNearClipDistance()
@@ -680,12 +1074,7 @@ namespace InteractivePipeSmokingVR
 
 	int VRInputTracker::GetHerbPipeFlippedDurationMs() const
 	{
-		if (!m_herbPipeHandFlipped)
-			return 0;
-
-		auto now = std::chrono::steady_clock::now();
-		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_herbPipeFlippedStartTime);
-		return static_cast<int>(duration.count());
+		return m_gestures.GetHeldMs(static_cast<int>(TrackerGesture::HerbPipeFlip));
 	}
 
 	bool VRInputTracker::IsSmokeItemHandNearFace() const
@@ -749,84 +1138,6 @@ namespace InteractivePipeSmokingVR
 		}
 	}
 
-	void VRInputTracker::UpdateHerbPipeRotationDetection()
-	{
-		// Only track if a herb pipe is equipped
-		if (!m_herbPipeInLeftHand && !m_herbPipeInRightHand)
-		{
-			m_herbPipeHandFlipped = false;
-			m_prevHerbPipeHandFlipped = false;
-			m_herbPipeFlippedLongEnough = false;
-			m_herbPipeEmptiedTriggered = false;
-			g_herbPipeFlippedLongEnough = false;
-			return;
-		}
-
-		// Store previous state
-		m_prevHerbPipeHandFlipped = m_herbPipeHandFlipped;
-
-		// Get the up vector of the hand holding the herb pipe
-		NiPoint3 upVector;
-		if (m_herbPipeInLeftHand)
-		{
-			upVector = m_leftControllerUpVector;
-		}
-		else
-		{
-			upVector = m_rightControllerUpVector;
-		}
-
-		// The controller is "flipped" when its up vector points downward (negative Z in world space)
-		// When holding normally, the controller's local Z (up) points roughly upward (positive world Z)
-		// When flipped 180 degrees, the controller's local Z points downward (negative world Z)
-		// 
-		// We check if the Z component of the up vector is negative (pointing down)
-		// A threshold of -0.5 means the controller is tilted more than ~60 degrees from horizontal
-		// A threshold of -0.7 means the controller is tilted more than ~45 degrees past horizontal (closer to fully inverted)
-		const float flipThreshold = -0.5f;
-		m_herbPipeHandFlipped = (upVector.z < flipThreshold);
-
-		// Log when flipped state changes
-		if (m_herbPipeHandFlipped && !m_prevHerbPipeHandFlipped)
-		{
-			m_herbPipeFlippedStartTime = std::chrono::steady_clock::now();
-			m_herbPipeEmptiedTriggered = false; // Reset trigger flag when starting a new flip
-			_MESSAGE("[VRInputTracker] Herb pipe hand FLIPPED (upVector.z=%.2f, threshold=%.2f) - timer started",
-				upVector.z, flipThreshold);
-		}
-		else if (!m_herbPipeHandFlipped && m_prevHerbPipeHandFlipped)
-		{
-			_MESSAGE("[VRInputTracker] Herb pipe hand UNFLIPPED (upVector.z=%.2f) - timer reset", upVector.z);
-			m_herbPipeFlippedLongEnough = false;
-			m_herbPipeEmptiedTriggered = false;
-			g_herbPipeFlippedLongEnough = false;
-		}
-
-		// Check if flipped long enough (2 seconds = 2000ms)
-		const int flippedDurationThresholdMs = 2000;
-		if (m_herbPipeHandFlipped)
-		{
-			int flippedDurationMs = GetHerbPipeFlippedDurationMs();
-			bool wasLongEnough = m_herbPipeFlippedLongEnough;
-			m_herbPipeFlippedLongEnough = (flippedDurationMs >= flippedDurationThresholdMs);
-			g_herbPipeFlippedLongEnough = m_herbPipeFlippedLongEnough;
-
-			// Log when the threshold is crossed and trigger emptying (only once per flip)
-			if (m_herbPipeFlippedLongEnough && !wasLongEnough && !m_herbPipeEmptiedTriggered)
-			{
-				_MESSAGE("[VRInputTracker] Herb pipe hand FLIPPED LONG ENOUGH (%d ms >= %d ms threshold) - EMPTYING PIPE",
-					flippedDurationMs, flippedDurationThresholdMs);
-				m_herbPipeEmptiedTriggered = true;
-				HandleHerbPipeEmptied();
-			}
-		}
-		else
-		{
-			m_herbPipeFlippedLongEnough = false;
-			g_herbPipeFlippedLongEnough = false;
-		}
-	}
-
 	void VRInputTracker::HandleHerbPipeEmptied()
 	{
 		_MESSAGE("[PipeEmpty] *** HERB PIPE EMPTIED - Dumping contents ***");
@@ -877,7 +1188,7 @@ namespace InteractivePipeSmokingVR
 		}
 
 		// Trigger haptic feedback to confirm emptying
-		TriggerHapticFeedback(m_herbPipeInLeftHand, m_herbPipeInRightHand, 0.3f, 0.2f);
+		TriggerHapticPattern(m_herbPipeInLeftHand, m_herbPipeInRightHand, HapticPattern::Notify);
 		_MESSAGE("[PipeEmpty]   -> Haptic feedback triggered on %s hand", m_herbPipeInLeftHand ? "LEFT" : "RIGHT");
 
 		// Convert VR controller hands to game hands for UnequipHerbPipeAndEquipEmpty
@@ -904,77 +1215,6 @@ namespace InteractivePipeSmokingVR
 		}
 	}
 
-	void VRInputTracker::UpdateLitPipeRotationDetection()
-	{
-		// Only track if a lit pipe is equipped (not rolled smoke - pipes only)
-		if (!m_litItemInLeftHand && !m_litItemInRightHand)
-		{
-			m_litPipeHandFlipped = false;
-			m_prevLitPipeHandFlipped = false;
-			m_litPipeFlippedLongEnough = false;
-			m_litPipeEmptiedTriggered = false;
-			return;
-		}
-
-		// Store previous state
-		m_prevLitPipeHandFlipped = m_litPipeHandFlipped;
-
-		// Get the up vector of the hand holding the lit pipe
-		NiPoint3 upVector;
-		if (m_litItemInLeftHand)
-		{
-			upVector = m_leftControllerUpVector;
-		}
-		else
-		{
-			upVector = m_rightControllerUpVector;
-		}
-
-		// The controller is "flipped" when its up vector points downward (negative Z in world space)
-		const float flipThreshold = -0.5f;
-		m_litPipeHandFlipped = (upVector.z < flipThreshold);
-
-		// Log when flipped state changes
-		if (m_litPipeHandFlipped && !m_prevLitPipeHandFlipped)
-		{
-			m_litPipeFlippedStartTime = std::chrono::steady_clock::now();
-			m_litPipeEmptiedTriggered = false;
-			_MESSAGE("[VRInputTracker] Lit pipe hand FLIPPED (upVector.z=%.2f, threshold=%.2f) - timer started",
-				upVector.z, flipThreshold);
-		}
-		else if (!m_litPipeHandFlipped && m_prevLitPipeHandFlipped)
-		{
-			_MESSAGE("[VRInputTracker] Lit pipe hand UNFLIPPED (upVector.z=%.2f) - timer reset", upVector.z);
-			m_litPipeFlippedLongEnough = false;
-			m_litPipeEmptiedTriggered = false;
-		}
-
-		// Check if flipped long enough (2 seconds = 2000ms)
-		const int flippedDurationThresholdMs = 2000;
-		if (m_litPipeHandFlipped)
-		{
-			auto now = std::chrono::steady_clock::now();
-			auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_litPipeFlippedStartTime);
-			int flippedDurationMs = static_cast<int>(duration.count());
-			
-			bool wasLongEnough = m_litPipeFlippedLongEnough;
-			m_litPipeFlippedLongEnough = (flippedDurationMs >= flippedDurationThresholdMs);
-
-			// Trigger emptying when threshold is crossed (only once per flip)
-			if (m_litPipeFlippedLongEnough && !wasLongEnough && !m_litPipeEmptiedTriggered)
-			{
-				_MESSAGE("[VRInputTracker] Lit pipe hand FLIPPED LONG ENOUGH (%d ms >= %d ms threshold) - EMPTYING LIT PIPE",
-					flippedDurationMs, flippedDurationThresholdMs);
-				m_litPipeEmptiedTriggered = true;
-				HandleLitPipeEmptied();
-			}
-		}
-		else
-		{
-			m_litPipeFlippedLongEnough = false;
-		}
-	}
-
 	void VRInputTracker::HandleLitPipeEmptied()
 	{
 		_MESSAGE("[PipeEmpty] *** LIT PIPE EMPTIED - Dumping contents ***");
@@ -1040,7 +1280,7 @@ namespace InteractivePipeSmokingVR
 		_MESSAGE("[PipeEmpty]   -> Cleared active smokable");
 
 		// Trigger haptic feedback to confirm emptying
-		TriggerHapticFeedback(m_litItemInLeftHand, m_litItemInRightHand, 0.3f, 0.2f);
+		TriggerHapticPattern(m_litItemInLeftHand, m_litItemInRightHand, HapticPattern::Notify);
 		_MESSAGE("[PipeEmpty]   -> Haptic feedback triggered on %s hand", m_litItemInLeftHand ? "LEFT" : "RIGHT");
 
 		// Note: DepleteLitPipeToEmpty finds the equipped item itself by checking both game hands,
@@ -1053,345 +1293,338 @@ namespace InteractivePipeSmokingVR
 		}
 	}
 
-	void VRInputTracker::UpdateLightingConditionDetection()
-	{
-		// Store previous state
-		m_prevLightingConditionMet = m_lightingConditionMet;
-
-		// Check if we have a fire spell equipped in either hand
-		bool hasFireSpell = m_fireSpellLeftHand || m_fireSpellRightHand;
-
-		// Check if we have a lightable item (herb pipe or unlit rolled smoke) in either hand
-		bool hasHerbPipe = m_herbPipeInLeftHand || m_herbPipeInRightHand;
-		bool hasUnlitRolledSmoke = m_unlitRolledSmokeInLeftHand || m_unlitRolledSmokeInRightHand;
-		bool hasLightableItem = hasHerbPipe || hasUnlitRolledSmoke;
+	// ============================================
+	// Gestures
+	// ============================================
 
-		// Lighting condition uses different radius based on item type:
-		// - Herb pipes use configPipeLightingRadius
-		// - Rolled smokes use configRolledSmokeLightingRadius (larger)
-		bool controllersNearEnough = false;
-		if (hasHerbPipe)
-		{
-			controllersNearEnough = m_controllersNearForPipeLighting;
-		}
-		else if (hasUnlitRolledSmoke)
-		{
-			controllersNearEnough = m_controllersNearForRolledSmokeLighting;
-		}
+	const VRInputTracker::GestureHandlers VRInputTracker::s_gestureHandlers[static_cast<int>(TrackerGesture::Count)] = {
+		// { onStart, onActive, onStage, onEnd } per TrackerGesture
+		{ nullptr, nullptr, &VRInputTracker::OnControllersTouchStage, &VRInputTracker::OnControllersTouchEnd },
+		{ &VRInputTracker::OnHerbPipeFlipStart, nullptr, &VRInputTracker::OnHerbPipeFlipStage, &VRInputTracker::OnHerbPipeFlipEnd },
+		{ &VRInputTracker::OnLitPipeFlipStart, nullptr, &VRInputTracker::OnLitPipeFlipStage, &VRInputTracker::OnLitPipeFlipEnd },
+		{ &VRInputTracker::OnLightingStart, &VRInputTracker::OnLightingActive, &VRInputTracker::OnLightingStage, &VRInputTracker::OnLightingEnd },
+		{ &VRInputTracker::OnHandSwapStart, nullptr, &VRInputTracker::OnHandSwapStage, &VRInputTracker::OnHandSwapEnd }
+	};
 
-		// Lighting condition: fire spell + lightable item + controllers near enough
-		m_lightingConditionMet = hasFireSpell && hasLightableItem && controllersNearEnough;
+	// "Lighting in progress" feedback channel, refreshed while the lighting gesture is held
+	static HapticSustainHandle GetLightingHaptic()
+	{
+		static const HapticSustainHandle lightingHaptic = RegisterSustainedHaptic("Lighting");
+		return lightingHaptic;
+	}
 
-		// Log and start timer when lighting condition is first met
-		if (m_lightingConditionMet && !m_prevLightingConditionMet)
-		{
-			m_lightingConditionStartTime = std::chrono::steady_clock::now();
-			m_lightingTriggered = false; // Reset trigger flag when starting new lighting attempt
-			m_burningSoundStarted = false; // Reset sound flag when starting new lighting attempt
+	bool VRInputTracker::IsOtherHandFree(bool smokableHandIsLeft) const
+	{
+		Actor* player = *g_thePlayer;
+		if (!player)
+			return false;
 
-			const char* fireHand = m_fireSpellLeftHand ? "LEFT" : "RIGHT";
-			const char* itemType = "Unknown";
-			const char* itemHand = "Unknown";
+		// Check the game hand of the VR controller that DOESN'T have the smokable
+		// In left-handed mode game hands are inverted relative to VR controllers:
+		// right VR controller = left game hand, left VR controller = right game hand
+		bool otherVRControllerIsLeft = !smokableHandIsLeft;
+		bool checkLeftGameHand = IsLeftHandedMode() ? !otherVRControllerIsLeft : otherVRControllerIsLeft;
+		if (player->GetEquippedObject(checkLeftGameHand) != nullptr)
+			return false;
 
-			if (m_herbPipeInLeftHand)
-			{
-				itemType = "Herb Pipe";
-				itemHand = "LEFT";
-			}
-			else if (m_herbPipeInRightHand)
-			{
-				itemType = "Herb Pipe";
-				itemHand = "RIGHT";
-			}
-			else if (m_unlitRolledSmokeInLeftHand)
-			{
-				itemType = "Unlit Rolled Smoke";
-				itemHand = "LEFT";
-			}
-			else if (m_unlitRolledSmokeInRightHand)
-			{
-				itemType = "Unlit Rolled Smoke";
-				itemHand = "RIGHT";
-			}
+		// An item grabbed with HIGGS (ingredient or other object) also blocks the swap
+		if (higgsInterface && higgsInterface->GetGrabbedObject(otherVRControllerIsLeft) != nullptr)
+			return false;
 
-			_MESSAGE("[Lighting] *** LIGHTING CONDITION MET! ***");
-			_MESSAGE("[Lighting]   -> Fire spell in %s hand", fireHand);
-			_MESSAGE("[Lighting]   -> %s in %s hand", itemType, itemHand);
-			_MESSAGE("[Lighting]   -> Using %s lighting radius: %.1f", 
-				hasHerbPipe ? "PIPE" : "ROLLED SMOKE",
-				hasHerbPipe ? configPipeLightingRadius : configRolledSmokeLightingRadius);
-			_MESSAGE("[Lighting]   -> Haptic feedback started - sound will play after 0.6 seconds, light after 3 seconds!");
-		}
-		else if (!m_lightingConditionMet && m_prevLightingConditionMet)
-		{
-			_MESSAGE("[Lighting] Lighting condition NO LONGER met - haptic feedback and sound stopped");
-			m_lightingTriggered = false;
-			m_burningSoundStarted = false;
+		return true;
+	}
 
-			// Stop burning sound when lighting condition ends
-			StopBurningSound();
-		}
+	UInt32 VRInputTracker::BuildGestureInputs() const
+	{
+		bool hasHerbPipe = m_herbPipeInLeftHand || m_herbPipeInRightHand;
+		bool hasLitItem = m_litItemInLeftHand || m_litItemInRightHand;
+		bool smokableInOneHand = m_smokeItemInLeftHand != m_smokeItemInRightHand;
+
+		// Flipped = the up vector of the holding hand points down (left hand wins if both hold one)
+		bool herbPipeFlipped = hasHerbPipe && GetControllerUpVector(m_herbPipeInLeftHand).z < PIPE_FLIP_UP_Z;
+		bool litItemFlipped = hasLitItem && GetControllerUpVector(m_litItemInLeftHand).z < PIPE_FLIP_UP_Z;
+
+		const bool flags[static_cast<int>(GestureInput::Count)] = {
+			m_leftNearFace,
+			m_rightNearFace,
+			m_controllersTouching,
+			m_controllersNearForPipeLighting,
+			m_controllersNearForRolledSmokeLighting,
+			m_fireSpellLeftHand || m_fireSpellRightHand,
+			hasHerbPipe,
+			m_unlitRolledSmokeInLeftHand || m_unlitRolledSmokeInRightHand,
+			herbPipeFlipped,
+			litItemFlipped,
+			smokableInOneHand,
+			smokableInOneHand && IsOtherHandFree(m_smokeItemInLeftHand)
+		};
+
+		UInt32 inputs = 0;
+		for (int i = 0; i < static_cast<int>(GestureInput::Count); i++)
+		{
+			inputs |= static_cast<UInt32>(flags[i]) << i;
+		}
+		return inputs;
+	}
 
-		// Timing thresholds
-		const int soundDelayMs = 600;       // 0.6 seconds before sound starts
-		const int lightingDurationThresholdMs = 3000; // 3 seconds to trigger lighting
+	void VRInputTracker::UpdateGestures()
+	{
+		m_gestureInputs = BuildGestureInputs();
+		m_gestures.Step(m_gestureInputs, std::chrono::steady_clock::now());
 
-		if (m_lightingConditionMet)
+		// Dispatch every gesture that is active or just ended, in table order
+		UInt32 started = m_gestures.GetStartedMask();
+		UInt32 active = m_gestures.GetActiveMask();
+		UInt32 ended = m_gestures.GetEndedMask();
+		UInt32 pending = active | ended;
+		for (int g = 0; pending != 0; g++, pending >>= 1)
 		{
-			// Get current duration
-			int durationMs = GetLightingConditionDurationMs();
+			if (!(pending & 1))
+				continue;
 
-			// Trigger continuous weak haptic feedback on the hand with the lightable item (starts immediately)
-			bool lightableInLeft = m_herbPipeInLeftHand || m_unlitRolledSmokeInLeftHand;
-			bool lightableInRight = m_herbPipeInRightHand || m_unlitRolledSmokeInRightHand;
-			TriggerHapticPulse(lightableInLeft, lightableInRight, 0.08f); // Weak continuous feedback
+			const GestureHandlers& handlers = s_gestureHandlers[g];
+			if (((started >> g) & 1) && handlers.onStart)
+				(this->*handlers.onStart)();
 
-			// Start burning sound after 1.3 seconds
-			if (durationMs >= soundDelayMs && !m_burningSoundStarted)
+			if (((active >> g) & 1) && handlers.onActive)
+				(this->*handlers.onActive)();
+
+			UInt32 stages = m_gestures.GetNewStages(g);
+			for (int stage = 0; stages != 0; stage++, stages >>= 1)
 			{
-				_MESSAGE("[Lighting] 1.3 seconds reached - starting burning sound!");
-				PlayRandomBurningSound();
-				m_burningSoundStarted = true;
+				if ((stages & 1) && handlers.onStage)
+					(this->*handlers.onStage)(stage);
 			}
 
-			// Check if held long enough to trigger lighting (3 seconds)
-			if (durationMs >= lightingDurationThresholdMs && !m_lightingTriggered)
-			{
-				_MESSAGE("[Lighting] *** LIGHTING TRIGGERED! (%d ms >= %d ms threshold) ***", durationMs, lightingDurationThresholdMs);
-				m_lightingTriggered = true;
+			if (((ended >> g) & 1) && handlers.onEnd)
+				(this->*handlers.onEnd)();
+		}
+	}
 
-				// Stop the burning sound now that lighting is complete
-				StopBurningSound();
-				m_burningSoundStarted = false;
+	// ControllersTouch - touching long enough enables pipe filling / smoke rolling
+	void VRInputTracker::OnControllersTouchStage(int stage)
+	{
+		g_controllersTouchingLongEnough = true;
+	}
 
-				// Trigger stronger haptic feedback to confirm lighting
-				TriggerHapticFeedback(lightableInLeft, lightableInRight, 0.5f, 0.3f);
+	void VRInputTracker::OnControllersTouchEnd()
+	{
+		g_controllersTouchingLongEnough = false;
+	}
 
-				// Determine what to light and call EquipStateManager to handle the swap
-				// Convert VR controller hands to game hands for the equip state manager
-				// In left-handed mode: left VR controller = right game hand, right VR controller = left game hand
-				if (g_equipStateManager)
-				{
-					if (m_herbPipeInLeftHand || m_herbPipeInRightHand)
-					{
-						bool gameLeftHand, gameRightHand;
-						if (IsLeftHandedMode())
-						{
-							gameLeftHand = m_herbPipeInRightHand;   // Right VR = Left game
-							gameRightHand = m_herbPipeInLeftHand;   // Left VR = Right game
-							_MESSAGE("[Lighting] Left-handed mode: VR(%s) -> Game(%s)",
-								m_herbPipeInLeftHand ? "LEFT" : "RIGHT",
-								gameLeftHand ? "LEFT" : "RIGHT");
-						}
-						else
-						{
-							gameLeftHand = m_herbPipeInLeftHand;    // Left VR = Left game
-							gameRightHand = m_herbPipeInRightHand;  // Right VR = Right game
-						}
-						g_equipStateManager->LightHerbPipe(gameLeftHand, gameRightHand);
-					}
-					else if (m_unlitRolledSmokeInLeftHand || m_unlitRolledSmokeInRightHand)
-					{
-						bool gameLeftHand, gameRightHand;
-						if (IsLeftHandedMode())
-						{
-							gameLeftHand = m_unlitRolledSmokeInRightHand;   // Right VR = Left game
-							gameRightHand = m_unlitRolledSmokeInLeftHand;   // Left VR = Right game
-							_MESSAGE("[Lighting] Left-handed mode: VR(%s) -> Game(%s)",
-								m_unlitRolledSmokeInLeftHand ? "LEFT" : "RIGHT",
-								gameLeftHand ? "LEFT" : "RIGHT");
-						}
-						else
-						{
-							gameLeftHand = m_unlitRolledSmokeInLeftHand;    // Left VR = Left game
-							gameRightHand = m_unlitRolledSmokeInRightHand;  // Right VR = Right game
-						}
-						g_equipStateManager->LightRolledSmoke(gameLeftHand, gameRightHand);
-					}
-				}
-			}
-		}
+	// HerbPipeFlip - herb pipe held upside down long enough empties it
+	void VRInputTracker::OnHerbPipeFlipStart()
+	{
+		_MESSAGE("[VRInputTracker] Herb pipe hand FLIPPED (upVector.z=%.2f, threshold=%.2f) - timer started",
+			GetControllerUpVector(m_herbPipeInLeftHand).z, PIPE_FLIP_UP_Z);
 	}
 
-	void VRInputTracker::UpdateHandSwapDetection()
+	void VRInputTracker::OnHerbPipeFlipStage(int stage)
 	{
-		// Hand swap detection:
-		// - One hand has a smokable (empty pipe, herb pipe, lit pipe, unlit/lit smoke)
-		// - Other hand is empty (no weapon/spell equipped AND no item grabbed)
-		// - Controllers touching for 2 seconds with 2 haptic pulses triggers the swap
-		// - BLOCKED if either hand is in face zone
+		_MESSAGE("[VRInputTracker] Herb pipe hand FLIPPED LONG ENOUGH (%d ms >= %d ms threshold) - EMPTYING PIPE",
+			GetHerbPipeFlippedDurationMs(), PIPE_FLIP_EMPTY_MS);
+		g_herbPipeFlippedLongEnough = true;
+		HandleHerbPipeEmptied();
+	}
 
-		// Check if either hand is in the face zone - block hand swap during smoking
-		if (m_leftNearFace || m_rightNearFace)
+	void VRInputTracker::OnHerbPipeFlipEnd()
+	{
+		if (m_herbPipeInLeftHand || m_herbPipeInRightHand)
 		{
-			if (m_handSwapConditionMet)
-			{
-				_MESSAGE("[HandSwap] Hand in face zone - swap cancelled");
-			}
-			m_handSwapHapticTriggered = false;
-			m_handSwapSecondHapticTriggered = false;
-			m_handSwapConditionMet = false;
-			return;
+			_MESSAGE("[VRInputTracker] Herb pipe hand UNFLIPPED (upVector.z=%.2f) - timer reset",
+				GetControllerUpVector(m_herbPipeInLeftHand).z);
 		}
+		g_herbPipeFlippedLongEnough = false;
+	}
 
-		// Check if we have a smokable in either hand
-		bool smokableInLeft = m_smokeItemInLeftHand;
-		bool smokableInRight = m_smokeItemInRightHand;
+	// LitPipeFlip - lit pipe held upside down long enough dumps its contents
+	void VRInputTracker::OnLitPipeFlipStart()
+	{
+		_MESSAGE("[VRInputTracker] Lit pipe hand FLIPPED (upVector.z=%.2f, threshold=%.2f) - timer started",
+			GetControllerUpVector(m_litItemInLeftHand).z, PIPE_FLIP_UP_Z);
+	}
 
-		// Need exactly one hand with smokable
-		bool hasSmokableInOneHand = (smokableInLeft && !smokableInRight) || (!smokableInLeft && smokableInRight);
+	void VRInputTracker::OnLitPipeFlipStage(int stage)
+	{
+		_MESSAGE("[VRInputTracker] Lit pipe hand FLIPPED LONG ENOUGH (%d ms >= %d ms threshold) - EMPTYING LIT PIPE",
+			m_gestures.GetHeldMs(static_cast<int>(TrackerGesture::LitPipeFlip)), PIPE_FLIP_EMPTY_MS);
+		HandleLitPipeEmptied();
+	}
 
-		if (!hasSmokableInOneHand)
+	void VRInputTracker::OnLitPipeFlipEnd()
+	{
+		if (m_litItemInLeftHand || m_litItemInRightHand)
 		{
-			// Reset all hand swap state when conditions aren't met
-			m_handSwapHapticTriggered = false;
-			m_handSwapSecondHapticTriggered = false;
-			m_handSwapConditionMet = false;
-			return;
+			_MESSAGE("[VRInputTracker] Lit pipe hand UNFLIPPED (upVector.z=%.2f) - timer reset",
+				GetControllerUpVector(m_litItemInLeftHand).z);
 		}
+	}
 
-		// Check if the OTHER hand is empty (no weapon equipped)
-		Actor* player = *g_thePlayer;
-		if (!player)
+	// Lighting - fire spell hand held at a herb pipe / unlit rolled smoke
+	void VRInputTracker::OnLightingStart()
+	{
+		bool hasHerbPipe = m_herbPipeInLeftHand || m_herbPipeInRightHand;
+		const char* fireHand = m_fireSpellLeftHand ? "LEFT" : "RIGHT";
+		const char* itemType = "Unknown";
+		const char* itemHand = "Unknown";
+
+		if (m_herbPipeInLeftHand)
 		{
-			m_handSwapHapticTriggered = false;
-			m_handSwapSecondHapticTriggered = false;
-			m_handSwapConditionMet = false;
-			return;
+			itemType = "Herb Pipe";
+			itemHand = "LEFT";
 		}
-
-		bool otherHandEmpty = false;
-		bool smokableHandIsLeft = smokableInLeft;
-
-		// Get what's equipped in the other hand
-		// Note: In left-handed mode, game hands are inverted relative to VR controllers
-		// m_smokeItemInLeftHand/Right refers to VR controller, not game hand
-		// We need to check the game's equipped items
-		
-		// Check the hand that DOESN'T have the smokable
-		if (smokableHandIsLeft)
+		else if (m_herbPipeInRightHand)
 		{
-			// Smokable in left VR controller, check right game hand
-			// In left-handed mode: right VR controller = left game hand
-			// In right-handed mode: right VR controller = right game hand
-			bool checkLeftGameHand = IsLeftHandedMode();
-			TESForm* otherHandItem = player->GetEquippedObject(checkLeftGameHand);
-			otherHandEmpty = (otherHandItem == nullptr);
+			itemType = "Herb Pipe";
+			itemHand = "RIGHT";
 		}
-		else
+		else if (m_unlitRolledSmokeInLeftHand)
+		{
+			itemType = "Unlit Rolled Smoke";
+			itemHand = "LEFT";
+		}
+		else if (m_unlitRolledSmokeInRightHand)
 		{
-			// Smokable in right VR controller, check left game hand
-			// In left-handed mode: left VR controller = right game hand
-			// In right-handed mode: left VR controller = left game hand
-			bool checkLeftGameHand = !IsLeftHandedMode();
-			TESForm* otherHandItem = player->GetEquippedObject(checkLeftGameHand);
-			otherHandEmpty = (otherHandItem == nullptr);
+			itemType = "Unlit Rolled Smoke";
+			itemHand = "RIGHT";
 		}
 
-		if (!otherHandEmpty)
+		_MESSAGE("[Lighting] *** LIGHTING CONDITION MET! ***");
+		_MESSAGE("[Lighting]   -> Fire spell in %s hand", fireHand);
+		_MESSAGE("[Lighting]   -> %s in %s hand", itemType, itemHand);
+		_MESSAGE("[Lighting]   -> Using %s lighting radius: %.1f",
+			hasHerbPipe ? "PIPE" : "ROLLED SMOKE",
+			hasHerbPipe ? configPipeLightingRadius : configRolledSmokeLightingRadius);
+		_MESSAGE("[Lighting]   -> Haptic feedback started - sound will play after %d ms, light after %d ms!",
+			LIGHTING_SOUND_DELAY_MS, LIGHTING_TRIGGER_MS);
+	}
+
+	void VRInputTracker::OnLightingActive()
+	{
+		// Continuous weak haptic feedback on the hand with the lightable item
+		bool lightableInLeft = m_herbPipeInLeftHand || m_unlitRolledSmokeInLeftHand;
+		bool lightableInRight = m_herbPipeInRightHand || m_unlitRolledSmokeInRightHand;
+		RefreshSustainedHaptic(GetLightingHaptic(), lightableInLeft, lightableInRight, HapticPattern::Sustain);
+	}
+
+	void VRInputTracker::OnLightingStage(int stage)
+	{
+		if (stage == 0)
 		{
-			// Other hand has something equipped, reset hand swap state
-			m_handSwapHapticTriggered = false;
-			m_handSwapSecondHapticTriggered = false;
-			m_handSwapConditionMet = false;
+			_MESSAGE("[Lighting] %d ms reached - starting burning sound!", LIGHTING_SOUND_DELAY_MS);
+			PlayRandomBurningSound();
 			return;
 		}
 
-		// Check if the other hand has a grabbed item (HIGGS)
-		// This prevents hand swap when holding an ingredient or other object
-		if (higgsInterface)
+		_MESSAGE("[Lighting] *** LIGHTING TRIGGERED! (%d ms >= %d ms threshold) ***",
+			GetLightingConditionDurationMs(), LIGHTING_TRIGGER_MS);
+
+		// Stop the burning sound now that lighting is complete
+		StopBurningSound();
+
+		// Trigger stronger haptic feedback to confirm lighting
+		bool lightableInLeft = m_herbPipeInLeftHand || m_unlitRolledSmokeInLeftHand;
+		bool lightableInRight = m_herbPipeInRightHand || m_unlitRolledSmokeInRightHand;
+		TriggerHapticPattern(lightableInLeft, lightableInRight, HapticPattern::Confirm);
+
+		// Determine what to light and call EquipStateManager to handle the swap
+		// Convert VR controller hands to game hands for the equip state manager
+		// In left-handed mode: left VR controller = right game hand, right VR controller = left game hand
+		if (g_equipStateManager)
 		{
-			// The "other" VR controller is the one without the smokable
-			bool otherVRControllerIsLeft = !smokableHandIsLeft;
-			TESObjectREFR* grabbedObject = higgsInterface->GetGrabbedObject(otherVRControllerIsLeft);
-			
-			if (grabbedObject != nullptr)
+			if (m_herbPipeInLeftHand || m_herbPipeInRightHand)
 			{
-				// Other hand has something grabbed, reset hand swap state
-				if (m_handSwapConditionMet)
+				bool gameLeftHand, gameRightHand;
+				if (IsLeftHandedMode())
 				{
-					_MESSAGE("[HandSwap] Other hand has grabbed item - swap cancelled");
+					gameLeftHand = m_herbPipeInRightHand;   // Right VR = Left game
+					gameRightHand = m_herbPipeInLeftHand;   // Left VR = Right game
+					_MESSAGE("[Lighting] Left-handed mode: VR(%s) -> Game(%s)",
+						m_herbPipeInLeftHand ? "LEFT" : "RIGHT",
+						gameLeftHand ? "LEFT" : "RIGHT");
 				}
-				m_handSwapHapticTriggered = false;
-				m_handSwapSecondHapticTriggered = false;
-				m_handSwapConditionMet = false;
-				return;
+				else
+				{
+					gameLeftHand = m_herbPipeInLeftHand;    // Left VR = Left game
+					gameRightHand = m_herbPipeInRightHand;  // Right VR = Right game
+				}
+				g_equipStateManager->LightHerbPipe(gameLeftHand, gameRightHand);
+			}
+			else if (m_unlitRolledSmokeInLeftHand || m_unlitRolledSmokeInRightHand)
+			{
+				bool gameLeftHand, gameRightHand;
+				if (IsLeftHandedMode())
+				{
+					gameLeftHand = m_unlitRolledSmokeInRightHand;   // Right VR = Left game
+					gameRightHand = m_unlitRolledSmokeInLeftHand;   // Left VR = Right game
+					_MESSAGE("[Lighting] Left-handed mode: VR(%s) -> Game(%s)",
+						m_unlitRolledSmokeInLeftHand ? "LEFT" : "RIGHT",
+						gameLeftHand ? "LEFT" : "RIGHT");
+				}
+				else
+				{
+					gameLeftHand = m_unlitRolledSmokeInLeftHand;    // Left VR = Left game
+					gameRightHand = m_unlitRolledSmokeInRightHand;  // Right VR = Right game
+				}
+				g_equipStateManager->LightRolledSmoke(gameLeftHand, gameRightHand);
 			}
 		}
+	}
 
-		// All basic conditions met (smokable in one hand, other hand truly empty)
-		// Now track touching duration
-		
-		// Timing thresholds
-		const int firstHapticDelayMs = 0;      // First haptic immediately when touching starts
-		const int secondHapticDelayMs = 1000;  // Second haptic at 1 second
-		const int swapTriggerDelayMs = 2000;   // Swap triggers at 2 seconds
-
-		// Check if controllers just started touching (rising edge)
-		if (m_controllersTouching && !m_prevControllersTouching)
-		{
-			// Controllers just started touching - start the timer
-			m_handSwapStartTime = std::chrono::steady_clock::now();
-			m_handSwapConditionMet = true;
-			m_handSwapHapticTriggered = false;
-			m_handSwapSecondHapticTriggered = false;
+	void VRInputTracker::OnLightingEnd()
+	{
+		_MESSAGE("[Lighting] Lighting condition NO LONGER met - haptic feedback and sound stopped");
+		CancelSustainedHaptic(GetLightingHaptic());
+		StopBurningSound();
+	}
 
-			_MESSAGE("[HandSwap] *** HANDS TOUCHING - SWAP TIMER STARTED ***");
-			_MESSAGE("[HandSwap]   -> Smokable in %s VR controller", smokableHandIsLeft ? "LEFT" : "RIGHT");
-			_MESSAGE("[HandSwap]   -> Other hand is EMPTY");
-			_MESSAGE("[HandSwap]   -> Hold for 2 seconds to swap...");
-		}
+	// HandSwap - smokable in one hand, other hand empty, hands touching: two pulses, then the smokable swaps hands
+	void VRInputTracker::OnHandSwapStart()
+	{
+		_MESSAGE("[HandSwap] *** HANDS TOUCHING - SWAP TIMER STARTED ***");
+		_MESSAGE("[HandSwap]   -> Smokable in %s VR controller", m_smokeItemInLeftHand ? "LEFT" : "RIGHT");
+		_MESSAGE("[HandSwap]   -> Other hand is EMPTY");
+		_MESSAGE("[HandSwap]   -> Hold for %d ms to swap...", HAND_SWAP_TRIGGER_MS);
+	}
 
-		// Check if controllers stopped touching
-		if (!m_controllersTouching && m_handSwapConditionMet)
+	void VRInputTracker::OnHandSwapStage(int stage)
+	{
+		if (stage < 2)
 		{
-			_MESSAGE("[HandSwap] Controllers separated - swap cancelled");
-			m_handSwapHapticTriggered = false;
-			m_handSwapSecondHapticTriggered = false;
-			m_handSwapConditionMet = false;
+			TriggerHapticPattern(true, true, HapticPattern::HandSwap);  // Strong pulse on BOTH hands (stages 0 and 1 make the double pulse)
+			_MESSAGE("[HandSwap] %s haptic pulse triggered (%d ms)", stage == 0 ? "First" : "Second",
+				stage == 0 ? 0 : HAND_SWAP_SECOND_PULSE_MS);
 			return;
 		}
 
-		// If condition is met and controllers are still touching, check timing
-		if (m_handSwapConditionMet && m_controllersTouching)
-		{
-			auto now = std::chrono::steady_clock::now();
-			int durationMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - m_handSwapStartTime).count());
-
-			// First haptic pulse (immediately)
-			if (!m_handSwapHapticTriggered && durationMs >= firstHapticDelayMs)
-			{
-				TriggerHapticFeedback(true, true, 0.8f, 0.15f);  // Strong pulse on BOTH hands
-				m_handSwapHapticTriggered = true;
-				_MESSAGE("[HandSwap] First haptic pulse triggered (0ms)");
-			}
-
-			// Second haptic pulse (at 1 second)
-			if (!m_handSwapSecondHapticTriggered && durationMs >= secondHapticDelayMs)
-			{
-				TriggerHapticFeedback(true, true, 0.8f, 0.15f);  // Strong pulse on BOTH hands
-				m_handSwapSecondHapticTriggered = true;
-				_MESSAGE("[HandSwap] Second haptic pulse triggered (1000ms)");
-			}
+		_MESSAGE("[HandSwap] *** %d ms REACHED - TRIGGERING SWAP! ***", HAND_SWAP_TRIGGER_MS);
 
-			// Trigger swap (at 2 seconds)
-			if (durationMs >= swapTriggerDelayMs)
-			{
-				_MESSAGE("[HandSwap] *** 2 SECONDS REACHED - TRIGGERING SWAP! ***");
+		// Unequip the dummy item from the current hand
+		// The armor will be auto-handled by the equip event handlers
+		if (g_equipStateManager)
+		{
+			bool smokableHandIsLeft = m_smokeItemInLeftHand;
+			_MESSAGE("[HandSwap] Unequipping smokable from %s VR controller...", smokableHandIsLeft ? "LEFT" : "RIGHT");
+			g_equipStateManager->UnequipCurrentSmokable(smokableHandIsLeft);
+		}
+	}
 
-				// Unequip the dummy item from the current hand
-				// The armor will be auto-handled by the equip event handlers
-				if (g_equipStateManager)
-				{
-					_MESSAGE("[HandSwap] Unequipping smokable from %s VR controller...", smokableHandIsLeft ? "LEFT" : "RIGHT");
-					g_equipStateManager->UnequipCurrentSmokable(smokableHandIsLeft);
-				}
+	void VRInputTracker::OnHandSwapEnd()
+	{
+		if (m_gestures.IsComplete(static_cast<int>(TrackerGesture::HandSwap)))
+			return;
 
-				// Reset state after triggering
-				m_handSwapHapticTriggered = false;
-				m_handSwapSecondHapticTriggered = false;
-				m_handSwapConditionMet = false;
-			}
+		if (m_gestureInputs & (GestureInputBit(GestureInput::LeftNearFace) | GestureInputBit(GestureInput::RightNearFace)))
+		{
+			_MESSAGE("[HandSwap] Hand in face zone - swap cancelled");
+		}
+		else if (!(m_gestureInputs & GestureInputBit(GestureInput::ControllersTouching)))
+		{
+			_MESSAGE("[HandSwap] Controllers separated - swap cancelled");
+		}
+		else if (!(m_gestureInputs & GestureInputBit(GestureInput::OtherHandFree)))
+		{
+			_MESSAGE("[HandSwap] Other hand no longer empty - swap cancelled");
 		}
 	}
 
@@ -1436,23 +1669,20 @@ namespace InteractivePipeSmokingVR
 
 		// We have a smokable in one hand and a grabbed item in the other
 		// Check if the controllers are close together (grabbed item near smokable hand)
-		float controllerDistance = GetControllerToControllerDistance();
-		
 		// Use the same touch radius as controller touching detection
-		bool isNear = (controllerDistance <= configControllerTouchRadius);
-		m_grabbedItemNearSmokableHand = isNear;
+		m_grabbedItemNearSmokableHand = m_proximity.IsInZone(ProximityZone::ControllersTouch);
 
 		// Log when state changes
 		if (m_grabbedItemNearSmokableHand && !m_prevGrabbedItemNearSmokableHand)
 		{
-			_MESSAGE("[GrabbedItemZone] Grabbed item ENTERED smokable hand zone (distance=%.2f)", controllerDistance);
+			_MESSAGE("[GrabbedItemZone] Grabbed item ENTERED smokable hand zone (distance=%.2f)", GetControllerToControllerDistance());
 			_MESSAGE("[GrabbedItemZone]   -> Smokable in %s VR controller, grabbed item in %s VR controller",
 				smokableHandIsLeft ? "LEFT" : "RIGHT",
 				otherHandIsLeft ? "LEFT" : "RIGHT");
 		}
 		else if (!m_grabbedItemNearSmokableHand && m_prevGrabbedItemNearSmokableHand)
 		{
-			_MESSAGE("[GrabbedItemZone] Grabbed item LEFT smokable hand zone (distance=%.2f)", controllerDistance);
+			_MESSAGE("[GrabbedItemZone] Grabbed item LEFT smokable hand zone (distance=%.2f)", GetControllerToControllerDistance());
 		}
 
 		// While grabbed item is near smokable hand, continuously re-apply cached finger positions
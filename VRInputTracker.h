@@ -1,6 +1,13 @@
 #pragma once
 
 #include "Helper.h"
+#include "TrackingScheduler.h"
+#include "SceneGraphResolver.h"
+#include "ProximityKernel.h"
+#include "ZoneRegistry.h"
+#include "PoseHistory.h"
+#include "OneEuroFilter.h"
+#include "GestureEngine.h"
 #include "skse64/NiTypes.h"
 #include "skse64/NiNodes.h"
 #include <atomic>
@@ -21,6 +28,101 @@ namespace InteractivePipeSmokingVR
 	// Near clip distance when smoking item is near face
 	constexpr float NEAR_CLIP_SMOKING_NEAR_FACE = 5.0f;
 
+	// Tracking update interval (10 updates per second)
+	constexpr int TRACKING_UPDATE_INTERVAL_MS = 100;
+
+	// Tracking modes (selected by TrackingMode in the INI)
+	enum class TrackingMode
+	{
+		Timer = 0,     // Scheduler thread queues an update task every TRACKING_UPDATE_INTERVAL_MS
+		Frame = 1,     // Update runs directly from the HIGGS post-update callback, once per rendered frame
+		Adaptive = 2   // Frame-driven, but the governor picks the update interval from proximity to the nearest boundary
+	};
+
+	// ============================================
+	// Adaptive Rate Governor
+	// Margin = distance (game units) from a hand to the closest detection boundary
+	// (face zone, touch/filling/rolling/lighting radii). Inside NEAR -> every frame,
+	// inside FAR -> mid rate, beyond FAR -> slow rate. Any running hold timer forces every frame.
+	// ============================================
+	constexpr float GOVERNOR_NEAR_MARGIN = 10.0f;
+	constexpr float GOVERNOR_FAR_MARGIN = 40.0f;
+	constexpr int GOVERNOR_MID_INTERVAL_MS = 50;
+	constexpr int GOVERNOR_FAR_INTERVAL_MS = 200;
+
+	// Up-vector Z above which a held pipe is considered far from the flip threshold (-0.5)
+	constexpr float GOVERNOR_FLIP_SAFE_UP_Z = 0.0f;
+
+	// ============================================
+	// Predictive Face Zone Entry (PredictiveZoneEntry=1)
+	// Each controller is extrapolated along its velocity relative to the head by the
+	// look-ahead; if that lands inside the face zone while approaching, the hand counts
+	// as near face one update early. A prediction is confirmed when the hand actually
+	// enters while still predicted, unconfirmed if it is dropped before.
+	// ============================================
+
+	// Upper bound of the look-ahead (a longer extrapolation is mostly guesswork)
+	constexpr int PREDICTION_MAX_LOOKAHEAD_MS = 150;
+
+	// ============================================
+	// Gestures
+	// The hold detectors (touch, pipe flips, lighting, hand swap) are declared in the
+	// gesture table (VRInputTracker.cpp) as predicates on the per-tick input mask below
+	// plus timed stages, and stepped by one GestureEngine.
+	// ============================================
+
+	// Up-vector Z below which the hand holding a pipe counts as flipped (pointing down)
+	constexpr float PIPE_FLIP_UP_Z = -0.5f;
+
+	// Hold times (ms)
+	constexpr int PIPE_FLIP_EMPTY_MS = 2000;
+	constexpr int LIGHTING_SOUND_DELAY_MS = 600;
+	constexpr int LIGHTING_TRIGGER_MS = 3000;
+	constexpr int HAND_SWAP_SECOND_PULSE_MS = 1000;
+	constexpr int HAND_SWAP_TRIGGER_MS = 2000;
+
+	// Per-tick gesture inputs, one bit each
+	enum class GestureInput : UInt32
+	{
+		LeftNearFace = 0,          // Left controller in the face zone (prediction applied)
+		RightNearFace,             // Right controller in the face zone (prediction applied)
+		ControllersTouching,       // Touch radius (rolled smoke lighting radius with unlit smoke + fire spell)
+		PipeLightingRange,         // Controllers within the pipe lighting radius
+		RolledSmokeLightingRange,  // Controllers within the rolled smoke lighting radius
+		FireSpell,                 // Fire spell in either hand
+		HerbPipe,                  // Herb pipe in either hand
+		UnlitRolledSmoke,          // Unlit rolled smoke in either hand
+		HerbPipeFlipped,           // Hand holding the herb pipe points down
+		LitItemFlipped,            // Hand holding the lit item points down
+		SmokableInOneHand,         // Smoke item in exactly one hand
+		OtherHandFree,             // The hand without the smoke item has nothing equipped or grabbed
+		Count
+	};
+
+	inline UInt32 GestureInputBit(GestureInput input)
+	{
+		return 1u << static_cast<UInt32>(input);
+	}
+
+	// Gestures in the tracker's gesture table
+	enum class TrackerGesture : int
+	{
+		ControllersTouch = 0,   // Touching for ControllerTouchDurationMs (pipe filling / smoke rolling)
+		HerbPipeFlip,           // Herb pipe held upside down - empties it
+		LitPipeFlip,            // Lit pipe held upside down - empties it
+		Lighting,               // Fire spell hand at the lightable item - burning sound, then lights it
+		HandSwap,               // Hands touching, smokable in one and the other free - two pulses, then swaps
+		Count
+	};
+
+	enum class GovernorTier
+	{
+		Frame = 0,  // Every frame
+		Mid = 1,    // GOVERNOR_MID_INTERVAL_MS
+		Far = 2,    // GOVERNOR_FAR_INTERVAL_MS
+		Count = 3
+	};
+
 	class VRInputTracker
 	{
 	public:
@@ -48,8 +150,71 @@ namespace InteractivePipeSmokingVR
 		// Update positions - called from game thread (e.g., from a hook or periodic check)
 		void Update();
 
-		// Schedule the next update (called after each update completes)
-		void ScheduleNextUpdate();
+		// Called by the queued update task when it starts running on the game thread (timing stats)
+		void OnUpdateTaskRun();
+
+		// Called by the queued update task once it has run on the game thread
+		void OnUpdateTaskComplete();
+
+		// Called every rendered frame from the HIGGS post-update callback (frame-locked mode only)
+		void OnFrameUpdate();
+
+		// Apply the configured tracking mode (starts/stops the scheduler as needed)
+		void RefreshTrackingMode();
+
+		// Rebuild the squared zone radius table from the config radii (after a config load)
+		void RefreshProximityRadii();
+
+		// Rebuild the head/body zone registry from the FaceZone settings and the [Zones] section (after a config load)
+		void RefreshZones();
+
+		// Apply the PositionFilter settings to the controller/HMD filters (after a config load)
+		void RefreshPositionFilters();
+
+		// Rebuild the gesture table (stage delays come from the config)
+		void RefreshGestures();
+
+		// Check if a controller is inside a registered zone (by name, e.g. "Lips" or an INI zone)
+		bool IsControllerInZone(bool isLeft, const char* zoneName) const;
+
+		// Check if tracking runs frame-locked instead of on the scheduler
+		bool IsFrameLocked() const { return m_frameLocked; }
+
+		// Adaptive governor state: current interval (0 = every frame) and updates run per tier
+		int GetGovernedIntervalMs() const { return m_governedIntervalMs; }
+		UInt64 GetGovernorTierUpdates(GovernorTier tier) const { return m_governorTierUpdates[static_cast<int>(tier)]; }
+		UInt64 GetGovernorFramesSkipped() const { return m_governorFramesSkipped; }
+
+		// Tracking scheduler counters (ticks handed to the game thread / ticks skipped because one was still pending)
+		UInt64 GetTicksIssued() const { return m_scheduler.GetTicksIssued(); }
+		UInt64 GetTicksMissed() const { return m_scheduler.GetTicksMissed(); }
+
+		// Write tracker clock lateness/period histograms to the log
+		void DumpTimingStats() const;
+
+		// Drop the cached hand/HMD node handles (player 3D rebuilt - load, race change, camera switch)
+		void InvalidateNodeCache();
+
+		// Node cache counters (lookups served from the cache / full skeleton searches / invalidations)
+		UInt64 GetNodeCacheHits() const { return m_nodeCacheHits; }
+		UInt64 GetNodeCacheMisses() const { return m_nodeCacheMisses; }
+		UInt64 GetNodeCacheInvalidations() const { return m_nodeCacheInvalidations; }
+
+		// Write the node cache counters to the log
+		void DumpNodeCacheStats() const;
+
+		// Pose history of a tracked point (timestamped poses, velocity and acceleration estimates)
+		const PoseHistory& GetControllerPoseHistory(bool isLeft) const { return isLeft ? m_leftPoseHistory : m_rightPoseHistory; }
+		const PoseHistory& GetHMDPoseHistory() const { return m_hmdPoseHistory; }
+
+		// How fast a controller is moving (game units per second, smoothed)
+		float GetControllerSpeed(bool isLeft) const { return GetControllerPoseHistory(isLeft).GetSpeed(); }
+
+		// Write every pose history to the log as CSV rows (offline analysis)
+		void DumpPoseHistory() const;
+
+		// Write the predicted / confirmed / unconfirmed face zone entry counters to the log
+		void DumpPredictionStats() const;
 
 		// Get current positions
 		NiPoint3 GetHMDPosition() const { return m_hmdPosition; }
@@ -106,7 +271,7 @@ namespace InteractivePipeSmokingVR
 		void SetLitItemEquippedHand(bool leftHand, bool rightHand);
 
 		// Check if herb pipe hand is flipped (facing down) long enough
-		bool IsHerbPipeHandFlippedLongEnough() const { return m_herbPipeFlippedLongEnough; }
+		bool IsHerbPipeHandFlippedLongEnough() const { return m_gestures.HasReachedStage(static_cast<int>(TrackerGesture::HerbPipeFlip), 0); }
 
 		// Get how long the herb pipe hand has been flipped (in milliseconds)
 		int GetHerbPipeFlippedDurationMs() const;
@@ -115,7 +280,7 @@ namespace InteractivePipeSmokingVR
 		void ForceRestoreNearClipDistance();
 
 		// Check if lighting condition is met (fire spell + herb pipe/unlit smoke + hands touching)
-		bool IsLightingConditionMet() const { return m_lightingConditionMet; }
+		bool IsLightingConditionMet() const { return m_gestures.IsActive(static_cast<int>(TrackerGesture::Lighting)); }
 
 		// Get how long the lighting condition has been met (in milliseconds)
 		int GetLightingConditionDurationMs() const;
@@ -124,7 +289,33 @@ namespace InteractivePipeSmokingVR
 		std::atomic<bool> m_isTracking;
 		std::atomic<bool> m_isPaused;  // True when paused due to menu being open
 		bool m_isInitialized;
-		std::atomic<bool> m_updatePending;
+
+		// Long-lived scheduler that owns the tracking cadence (timer mode)
+		TrackingScheduler m_scheduler;
+
+		// True when updates are driven by the per-frame HIGGS callback instead of the scheduler
+		bool m_frameLocked;
+
+		// Adaptive governor (frame-driven, decimated by elapsed time)
+		bool m_adaptive;
+		GovernorTier m_governorTier;
+		int m_governedIntervalMs;
+		std::chrono::steady_clock::time_point m_lastUpdateTime;
+		UInt64 m_governorTierUpdates[static_cast<int>(GovernorTier::Count)];
+		UInt64 m_governorFramesSkipped;
+
+		// Cached skeleton nodes - resolved once, held by reference, re-resolved when the player's
+		// root node changes or a cached node is detached from the skeleton
+		NiPointer<NiNode> m_cachedRoot;
+		NiPointer<NiAVObject> m_cachedLeftHand;
+		NiPointer<NiAVObject> m_cachedRightHand;
+		NiPointer<NiAVObject> m_cachedHMD;
+		UInt64 m_nodeCacheHits;
+		UInt64 m_nodeCacheMisses;
+		UInt64 m_nodeCacheInvalidations;
+
+		// Resolves every stale cached node in one skeleton walk (targets: left hand, right hand, HMD)
+		SceneGraphResolver m_nodeResolver;
 
 		// Current positions
 		NiPoint3 m_hmdPosition;
@@ -136,20 +327,45 @@ namespace InteractivePipeSmokingVR
 		NiPoint3 m_leftControllerUpVector;
 		NiPoint3 m_rightControllerUpVector;
 
+		// Jitter filters applied to the sampled positions before any zone test
+		OneEuroFilter m_leftPositionFilter;
+		OneEuroFilter m_rightPositionFilter;
+		OneEuroFilter m_hmdPositionFilter;
+
+		// Pose history per tracked point, timestamped against m_poseClockStart
+		PoseHistory m_leftPoseHistory;
+		PoseHistory m_rightPoseHistory;
+		PoseHistory m_hmdPoseHistory;
+		std::chrono::steady_clock::time_point m_poseClockStart;
+
+		// Zone memberships of the current positions (all radii, evaluated once per update)
+		ProximityKernel m_proximity;
+
+		// Head/body-relative zones (lips + INI zones), evaluated once per update
+		ZoneRegistry m_zones;
+		int m_lipsZone;
+		UInt32 m_prevLeftZoneMask;
+		UInt32 m_prevRightZoneMask;
+
 		// Near face state
 		bool m_leftNearFace;
 		bool m_rightNearFace;
 		bool m_prevLeftNearFace;
 		bool m_prevRightNearFace;
 
+		// Predictive entry state: near face only because of the extrapolated position
+		bool m_leftEntryPredicted;
+		bool m_rightEntryPredicted;
+		UInt64 m_predictedEntries;
+		UInt64 m_confirmedEntries;
+		UInt64 m_unconfirmedEntries;
+
 		// Controllers touching state
 		bool m_controllersTouching;
-		bool m_prevControllersTouching;
 		bool m_controllersNearForPipeFilling;  // Separate check with pipe filling radius
 		bool m_controllersNearForSmokeRolling;  // Separate check with smoke rolling radius
 		bool m_controllersNearForPipeLighting;  // Separate check with pipe lighting radius
 		bool m_controllersNearForRolledSmokeLighting;  // Separate check with rolled smoke lighting radius
-		std::chrono::steady_clock::time_point m_controllersTouchStartTime;
 
 		// Fire spell equipped state
 		bool m_fireSpellLeftHand;
@@ -173,26 +389,9 @@ namespace InteractivePipeSmokingVR
 		bool m_litItemInLeftHand;
 		bool m_litItemInRightHand;
 
-		// Lighting condition state (fire spell + lightable item + hands touching)
-		bool m_lightingConditionMet;
-		bool m_prevLightingConditionMet;
-		bool m_lightingTriggered; // Prevents multiple triggers
-		bool m_burningSoundStarted; // Track if burning sound has started
-		std::chrono::steady_clock::time_point m_lightingConditionStartTime;
-
-		// Herb pipe flipped state (controller facing down)
-		bool m_herbPipeHandFlipped;
-		bool m_prevHerbPipeHandFlipped;
-		bool m_herbPipeFlippedLongEnough;
-		bool m_herbPipeEmptiedTriggered; // Prevents multiple triggers while flipped
-		std::chrono::steady_clock::time_point m_herbPipeFlippedStartTime;
-
-		// Lit pipe flipped state (controller facing down - for dumping contents)
-		bool m_litPipeHandFlipped;
-		bool m_prevLitPipeHandFlipped;
-		bool m_litPipeFlippedLongEnough;
-		bool m_litPipeEmptiedTriggered; // Prevents multiple triggers while flipped
-		std::chrono::steady_clock::time_point m_litPipeFlippedStartTime;
+		// Hold gestures (touch, flips, lighting, hand swap) and the inputs of the last step
+		GestureEngine m_gestures;
+		UInt32 m_gestureInputs;
 
 		// Track if smoke item hand was near face (for near clip adjustment)
 		bool m_smokeItemHandNearFace;
@@ -207,14 +406,33 @@ namespace InteractivePipeSmokingVR
 		static const char* kRightHandName;
 		static const char* kHMDNodeName;
 
-		// Helper to find a node by name in the player's skeleton
-		NiAVObject* FindNodeByName(NiAVObject* root, const char* name);
-		NiAVObject* GetPlayerHandNode(bool rightHand);
-		NiAVObject* GetPlayerHMDNode();
+		// Current player root, invalidating the node cache if it was rebuilt (nullptr = no 3D)
+		NiNode* ValidateNodeCache();
+
+		// Make sure the cached hand/HMD handles are current, re-resolving any stale ones in a single walk
+		void RefreshNodeCache();
 
 		// Helper to calculate distance between two points
 		float CalculateDistance(const NiPoint3& a, const NiPoint3& b) const;
 
+		// Pick the next update interval from the current poses (adaptive mode)
+		void UpdateRateGovernor();
+
+		// True while any hold timer is running (gestures, inhale, near clip restore)
+		bool IsAnyDetectionTimerRunning() const;
+
+		// Log controllers entering/leaving the INI zones
+		void UpdateZoneTransitions();
+
+		// Extrapolation time for predictive entry (seconds)
+		float GetPredictionLookAheadSeconds() const;
+
+		// True if the controller, extrapolated by lookAhead relative to the head, is inside the face zone while approaching it
+		bool IsFaceZoneEntryPredicted(bool isLeft, float lookAhead) const;
+
+		// Apply predictive entry to one hand's near face flag and update the counters
+		void ApplyPredictedEntry(bool isLeft, bool& nearFace, bool& entryPredicted, float lookAhead);
+
 		// Update near face detection
 		void UpdateNearFaceDetection();
 
@@ -227,14 +445,43 @@ namespace InteractivePipeSmokingVR
 		// Update near clip distance based on smoke item hand near face
 		void UpdateNearClipForSmokeItem();
 
-		// Update herb pipe rotation detection (flipped = facing down)
-		void UpdateHerbPipeRotationDetection();
-
-		// Update lit pipe rotation detection (flipped = facing down for dumping)
-		void UpdateLitPipeRotationDetection();
-
-		// Update lighting condition detection
-		void UpdateLightingConditionDetection();
+		// Up vector of a controller
+		const NiPoint3& GetControllerUpVector(bool isLeft) const { return isLeft ? m_leftControllerUpVector : m_rightControllerUpVector; }
+
+		// True if the VR controller without the smoke item has nothing equipped (game hand) or grabbed (HIGGS)
+		bool IsOtherHandFree(bool smokableHandIsLeft) const;
+
+		// Collect this tick's gesture inputs (GestureInputBit per input)
+		UInt32 BuildGestureInputs() const;
+
+		// Step the gestures and dispatch their events to the handler table
+		void UpdateGestures();
+
+		// Gesture handlers, one row per TrackerGesture (any entry may be null)
+		struct GestureHandlers
+		{
+			void (VRInputTracker::*onStart)();
+			void (VRInputTracker::*onActive)();          // Every tick while active
+			void (VRInputTracker::*onStage)(int stage);  // Stage reached
+			void (VRInputTracker::*onEnd)();
+		};
+		static const GestureHandlers s_gestureHandlers[static_cast<int>(TrackerGesture::Count)];
+
+		void OnControllersTouchStage(int stage);
+		void OnControllersTouchEnd();
+		void OnHerbPipeFlipStart();
+		void OnHerbPipeFlipStage(int stage);
+		void OnHerbPipeFlipEnd();
+		void OnLitPipeFlipStart();
+		void OnLitPipeFlipStage(int stage);
+		void OnLitPipeFlipEnd();
+		void OnLightingStart();
+		void OnLightingActive();
+		void OnLightingStage(int stage);
+		void OnLightingEnd();
+		void OnHandSwapStart();
+		void OnHandSwapStage(int stage);
+		void OnHandSwapEnd();
 
 		// Handle herb pipe emptying (called when flipped long enough)
 		void HandleHerbPipeEmptied();
@@ -242,18 +489,9 @@ namespace InteractivePipeSmokingVR
 		// Handle lit pipe emptying (called when flipped long enough)
 		void HandleLitPipeEmptied();
 
-		// Update hand swap detection (smokable in one hand, other empty, hands touching)
-		void UpdateHandSwapDetection();
-
 		// Update grabbed item near smokable hand detection
 		void UpdateGrabbedItemNearSmokableHandDetection();
 
-		// Track hand swap state
-		bool m_handSwapHapticTriggered;
-		bool m_handSwapSecondHapticTriggered;
-		bool m_handSwapConditionMet;
-		std::chrono::steady_clock::time_point m_handSwapStartTime;
-
 		// Track grabbed item near smokable hand state
 		bool m_grabbedItemNearSmokableHand;
 		bool m_prevGrabbedItemNearSmokableHand;
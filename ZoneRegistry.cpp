@@ -0,0 +1,197 @@
+#include "ZoneRegistry.h"
+#include <cstring>
+
+namespace InteractivePipeSmokingVR
+{
+	static const char* kAnchorNames[static_cast<int>(ZoneAnchor::Count)] = { "Head", "Body" };
+
+	// Point in an anchor's local space (inverse of an orthonormal rotation is its transpose)
+	static NiPoint3 ToAnchorLocal(const NiTransform& anchor, const NiPoint3& world)
+	{
+		float dx = world.x - anchor.pos.x;
+		float dy = world.y - anchor.pos.y;
+		float dz = world.z - anchor.pos.z;
+
+		NiPoint3 local;
+		local.x = anchor.rot.data[0][0] * dx + anchor.rot.data[1][0] * dy + anchor.rot.data[2][0] * dz;
+		local.y = anchor.rot.data[0][1] * dx + anchor.rot.data[1][1] * dy + anchor.rot.data[2][1] * dz;
+		local.z = anchor.rot.data[0][2] * dx + anchor.rot.data[1][2] * dy + anchor.rot.data[2][2] * dz;
+		return local;
+	}
+
+	// ============================================
+	// ZoneRegistry Implementation
+	// ============================================
+
+	ZoneRegistry::ZoneRegistry()
+		: m_zoneCount(0)
+		, m_leftMask(0)
+		, m_rightMask(0)
+	{
+		for (int a = 0; a <= static_cast<int>(ZoneAnchor::Count); a++)
+		{
+			m_anchorBegin[a] = 0;
+		}
+		for (int a = 0; a < static_cast<int>(ZoneAnchor::Count); a++)
+		{
+			m_anchorValid[a] = false;
+		}
+	}
+
+	void ZoneRegistry::Build(const std::vector<ZoneDefinition>& zones, float exitBand)
+	{
+		m_zoneCount = 0;
+
+		if (exitBand < 0.0f)
+			exitBand = 0.0f;
+
+		// Counting sort by anchor so each anchor's zones are contiguous
+		for (int a = 0; a < static_cast<int>(ZoneAnchor::Count); a++)
+		{
+			m_anchorBegin[a] = m_zoneCount;
+
+			for (const ZoneDefinition& zone : zones)
+			{
+				if (static_cast<int>(zone.anchor) != a)
+					continue;
+
+				if (m_zoneCount >= ZONE_MAX_ZONES)
+				{
+					_MESSAGE("[Zones] WARNING: Zone limit (%d) reached - '%s' ignored", ZONE_MAX_ZONES, zone.name.c_str());
+					continue;
+				}
+
+				int i = m_zoneCount++;
+				m_names[i] = zone.name;
+				m_startX[i] = zone.start.x;
+				m_startY[i] = zone.start.y;
+				m_startZ[i] = zone.start.z;
+
+				bool capsule = (zone.shape == ZoneShape::Capsule);
+				m_axisX[i] = capsule ? zone.end.x - zone.start.x : 0.0f;
+				m_axisY[i] = capsule ? zone.end.y - zone.start.y : 0.0f;
+				m_axisZ[i] = capsule ? zone.end.z - zone.start.z : 0.0f;
+
+				float lengthSquared = m_axisX[i] * m_axisX[i] + m_axisY[i] * m_axisY[i] + m_axisZ[i] * m_axisZ[i];
+				m_inverseAxisLengthSquared[i] = (lengthSquared > 0.0f) ? 1.0f / lengthSquared : 0.0f;
+
+				float exitRadius = zone.radius + exitBand;
+				m_radiusSquared[i] = (zone.radius > 0.0f) ? zone.radius * zone.radius : -1.0f;
+				m_exitRadiusSquared[i] = (zone.radius > 0.0f) ? exitRadius * exitRadius : -1.0f;
+
+				_MESSAGE("[Zones] Zone %d '%s': %s-relative %s at (%.1f, %.1f, %.1f), radius %.1f", i, zone.name.c_str(),
+					kAnchorNames[a], capsule ? "capsule" : "sphere", zone.start.x, zone.start.y, zone.start.z, zone.radius);
+			}
+		}
+		m_anchorBegin[static_cast<int>(ZoneAnchor::Count)] = m_zoneCount;
+
+		m_leftMask = 0;
+		m_rightMask = 0;
+	}
+
+	int ZoneRegistry::FindZone(const char* name) const
+	{
+		if (!name)
+			return -1;
+
+		for (int i = 0; i < m_zoneCount; i++)
+		{
+			if (_stricmp(m_names[i].c_str(), name) == 0)
+				return i;
+		}
+		return -1;
+	}
+
+	const char* ZoneRegistry::GetZoneName(int index) const
+	{
+		if (index < 0 || index >= m_zoneCount)
+			return "";
+		return m_names[index].c_str();
+	}
+
+	void ZoneRegistry::Evaluate(const NiTransform* anchors[static_cast<int>(ZoneAnchor::Count)],
+		const NiPoint3& leftController, const NiPoint3& rightController)
+	{
+		UInt32 leftMask = 0;
+		UInt32 rightMask = 0;
+		UInt32 previousLeftMask = m_leftMask;
+		UInt32 previousRightMask = m_rightMask;
+
+		for (int a = 0; a < static_cast<int>(ZoneAnchor::Count); a++)
+		{
+			m_anchorValid[a] = (anchors[a] != nullptr);
+			if (!m_anchorValid[a])
+				continue;
+
+			m_anchorTransforms[a] = *anchors[a];
+
+			NiPoint3 left = ToAnchorLocal(*anchors[a], leftController);
+			NiPoint3 right = ToAnchorLocal(*anchors[a], rightController);
+
+			for (int i = m_anchorBegin[a]; i < m_anchorBegin[a + 1]; i++)
+			{
+				// Closest point on the segment start + t * axis (t = 0 for spheres), then distance squared
+				float lx = left.x - m_startX[i];
+				float ly = left.y - m_startY[i];
+				float lz = left.z - m_startZ[i];
+				float rx = right.x - m_startX[i];
+				float ry = right.y - m_startY[i];
+				float rz = right.z - m_startZ[i];
+
+				float lt = (lx * m_axisX[i] + ly * m_axisY[i] + lz * m_axisZ[i]) * m_inverseAxisLengthSquared[i];
+				float rt = (rx * m_axisX[i] + ry * m_axisY[i] + rz * m_axisZ[i]) * m_inverseAxisLengthSquared[i];
+				lt = (lt < 0.0f) ? 0.0f : (lt > 1.0f) ? 1.0f : lt;
+				rt = (rt < 0.0f) ? 0.0f : (rt > 1.0f) ? 1.0f : rt;
+
+				lx -= lt * m_axisX[i];
+				ly -= lt * m_axisY[i];
+				lz -= lt * m_axisZ[i];
+				rx -= rt * m_axisX[i];
+				ry -= rt * m_axisY[i];
+				rz -= rt * m_axisZ[i];
+
+				// Controllers already inside test against the exit radius
+				UInt32 bit = 1u << i;
+				float leftRadiusSquared = (previousLeftMask & bit) ? m_exitRadiusSquared[i] : m_radiusSquared[i];
+				float rightRadiusSquared = (previousRightMask & bit) ? m_exitRadiusSquared[i] : m_radiusSquared[i];
+				if (lx * lx + ly * ly + lz * lz <= leftRadiusSquared)
+					leftMask |= bit;
+				if (rx * rx + ry * ry + rz * rz <= rightRadiusSquared)
+					rightMask |= bit;
+			}
+		}
+
+		m_leftMask = leftMask;
+		m_rightMask = rightMask;
+	}
+
+	bool ZoneRegistry::IsControllerInZone(bool isLeft, int index) const
+	{
+		if (index < 0 || index >= m_zoneCount)
+			return false;
+		return ((isLeft ? m_leftMask : m_rightMask) & (1u << index)) != 0;
+	}
+
+	bool ZoneRegistry::GetZoneWorldCenter(int index, NiPoint3& worldOut) const
+	{
+		if (index < 0 || index >= m_zoneCount)
+			return false;
+
+		int a = 0;
+		while (index >= m_anchorBegin[a + 1])
+			a++;
+
+		if (!m_anchorValid[a])
+			return false;
+
+		// World = anchor position + anchor rotation * local offset
+		const NiTransform& anchor = m_anchorTransforms[a];
+		float x = m_startX[index];
+		float y = m_startY[index];
+		float z = m_startZ[index];
+		worldOut.x = anchor.pos.x + anchor.rot.data[0][0] * x + anchor.rot.data[0][1] * y + anchor.rot.data[0][2] * z;
+		worldOut.y = anchor.pos.y + anchor.rot.data[1][0] * x + anchor.rot.data[1][1] * y + anchor.rot.data[1][2] * z;
+		worldOut.z = anchor.pos.z + anchor.rot.data[2][0] * x + anchor.rot.data[2][1] * y + anchor.rot.data[2][2] * z;
+		return true;
+	}
+}
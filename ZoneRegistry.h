@@ -0,0 +1,110 @@
+#pragma once
+
+#include "skse64/NiTypes.h"
+#include <string>
+#include <vector>
+
+namespace InteractivePipeSmokingVR
+{
+	// ============================================
+	// Zone Registry
+	// Named interaction zones attached to the player - spheres and capsules with
+	// offsets relative to the head (HMD node) or the body (player root node).
+	// The built-in "Lips" zone comes from the FaceZone settings; any number of
+	// additional zones are declared in the [Zones] section of the INI.
+	//
+	// Zones are stored as a structure of arrays grouped by anchor. Once per tick
+	// both controllers are brought into each anchor's local space (one inverse
+	// transform per anchor and hand), then every zone is tested against them in
+	// one linear pass over the arrays - spheres are capsules of zero length, so
+	// there is a single branch-free test. Results are one membership bitmask per
+	// controller. A controller inside a zone stays inside until it leaves the exit
+	// radius (radius + exit band), so boundary jitter does not toggle membership.
+	// ============================================
+
+	// Zones a registry can hold (one bit each in the membership masks)
+	constexpr int ZONE_MAX_ZONES = 32;
+
+	// Name of the built-in zone around the lips (FaceZoneOffset/FaceZoneRadius)
+	constexpr const char* ZONE_LIPS_NAME = "Lips";
+
+	enum class ZoneAnchor : UInt32
+	{
+		Head = 0,   // HMD node: X = right, Y = forward, Z = up
+		Body,       // Player root node: same axes, origin at the feet
+		Count
+	};
+
+	enum class ZoneShape : UInt32
+	{
+		Sphere = 0,   // Around start
+		Capsule       // Around the segment start -> end
+	};
+
+	// A zone as declared in the INI
+	struct ZoneDefinition
+	{
+		std::string name;
+		ZoneAnchor anchor;
+		ZoneShape shape;
+		NiPoint3 start;   // Offset in the anchor's local space
+		NiPoint3 end;     // Capsules only
+		float radius;
+	};
+
+	class ZoneRegistry
+	{
+	public:
+		ZoneRegistry();
+
+		// Replace the zone set (at most ZONE_MAX_ZONES; the rest are dropped with a warning).
+		// exitBand is added to every radius for controllers already inside. Zone indices are stable until the next Build.
+		void Build(const std::vector<ZoneDefinition>& zones, float exitBand);
+
+		int GetZoneCount() const { return m_zoneCount; }
+
+		// Index of a zone by name (case-insensitive), -1 if not registered
+		int FindZone(const char* name) const;
+
+		const char* GetZoneName(int index) const;
+
+		// Test every zone against both controllers. An anchor without a transform
+		// (nullptr, e.g. no 3D yet) reports none of its zones as entered.
+		void Evaluate(const NiTransform* anchors[static_cast<int>(ZoneAnchor::Count)],
+			const NiPoint3& leftController, const NiPoint3& rightController);
+
+		// Membership masks from the last Evaluate (bit = zone index)
+		UInt32 GetLeftMask() const { return m_leftMask; }
+		UInt32 GetRightMask() const { return m_rightMask; }
+
+		bool IsControllerInZone(bool isLeft, int index) const;
+
+		// World position of a zone's start point (sphere center) from the last Evaluate.
+		// Returns false if the zone is unknown or its anchor had no transform.
+		bool GetZoneWorldCenter(int index, NiPoint3& worldOut) const;
+
+	private:
+		// Zone data, grouped by anchor: zones [m_anchorBegin[a], m_anchorBegin[a + 1]) use anchor a
+		float m_startX[ZONE_MAX_ZONES];
+		float m_startY[ZONE_MAX_ZONES];
+		float m_startZ[ZONE_MAX_ZONES];
+		float m_axisX[ZONE_MAX_ZONES];         // end - start (zero for spheres)
+		float m_axisY[ZONE_MAX_ZONES];
+		float m_axisZ[ZONE_MAX_ZONES];
+		float m_inverseAxisLengthSquared[ZONE_MAX_ZONES];   // 0 for spheres
+		float m_radiusSquared[ZONE_MAX_ZONES];
+		float m_exitRadiusSquared[ZONE_MAX_ZONES];
+		int m_anchorBegin[static_cast<int>(ZoneAnchor::Count) + 1];
+
+		// Cold data
+		std::string m_names[ZONE_MAX_ZONES];
+		int m_zoneCount;
+
+		// Anchor transforms from the last Evaluate
+		NiTransform m_anchorTransforms[static_cast<int>(ZoneAnchor::Count)];
+		bool m_anchorValid[static_cast<int>(ZoneAnchor::Count)];
+
+		UInt32 m_leftMask;
+		UInt32 m_rightMask;
+	};
+}
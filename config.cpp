@@ -13,6 +13,14 @@ namespace InteractivePipeSmokingVR {
 	float configFaceZoneOffsetZ = -5.0f;   // Down offset (negative = below head center, towards lips)
 	float configFaceZoneRadius = 15.0f;    // Detection radius in game units
 
+	// Additional head/body-relative zones ([Zones] section)
+	std::vector<ZoneDefinition> configZones;
+
+	// Zone hysteresis and position filtering
+	float configZoneHysteresis = 1.5f;           // Exit radius = radius + 1.5 units
+	float configPositionFilterMinCutoff = 1.5f;  // Hz at rest
+	float configPositionFilterBeta = 0.05f;      // ~11 Hz at 200 units/s
+
 	// Controller touch detection
 	float configControllerTouchRadius = 10.0f;  // Distance threshold for controllers "touching"
 	float configRolledSmokeLightingRadius = 18.0f;  // Larger distance for rolled smoke ignition with flames
@@ -23,6 +31,14 @@ namespace InteractivePipeSmokingVR {
 	// Near clip restore delay (milliseconds) - how long to wait after leaving face zone before restoring near clip
 	int configNearClipRestoreDelayMs = 2000;  // 2 seconds default
 
+	// VR tracking mode (0 = timer, 1 = frame-locked, 2 = adaptive)
+	int configTrackingMode = 0;  // Timer mode default
+	int configTrackingClockPolicy = 0;  // Skip missed ticks default
+
+	// Predictive face zone entry (off by default, look-ahead follows the update interval)
+	int configPredictiveZoneEntry = 0;
+	int configPredictiveLookAheadMs = 0;
+
 	// Smokable ingredient scale when grabbed with empty pipe equipped (0.35 = 35% of original, 65% reduction)
 	float configSmokableGrabbedScale = 0.50f;
 
@@ -48,6 +64,68 @@ namespace InteractivePipeSmokingVR {
 	int configHealingInhalesToCast = 5;  // Number of inhales before casting healing spell
 	int configMaxInhalesPerHerb = 25;  // Maximum inhales before herb depletes
 
+	// Parse one [Zones] entry: "Anchor, Shape, X, Y, Z[, X2, Y2, Z2], Radius"
+	static bool ParseZoneDefinition(const std::string& name, const std::string& value, ZoneDefinition& zone)
+	{
+		std::vector<std::string> fields = split(value, ',');
+		for (std::string& field : fields)
+		{
+			trim(field);
+		}
+
+		if (fields.size() < 2)
+			return false;
+
+		zone.name = name;
+
+		if (_stricmp(fields[0].c_str(), "Head") == 0)
+			zone.anchor = ZoneAnchor::Head;
+		else if (_stricmp(fields[0].c_str(), "Body") == 0)
+			zone.anchor = ZoneAnchor::Body;
+		else
+			return false;
+
+		size_t expectedFields;
+		if (_stricmp(fields[1].c_str(), "Sphere") == 0)
+		{
+			zone.shape = ZoneShape::Sphere;
+			expectedFields = 6;
+		}
+		else if (_stricmp(fields[1].c_str(), "Capsule") == 0)
+		{
+			zone.shape = ZoneShape::Capsule;
+			expectedFields = 9;
+		}
+		else
+		{
+			return false;
+		}
+
+		if (fields.size() != expectedFields)
+			return false;
+
+		try
+		{
+			zone.start.x = std::stof(fields[2]);
+			zone.start.y = std::stof(fields[3]);
+			zone.start.z = std::stof(fields[4]);
+			zone.end = zone.start;
+			if (zone.shape == ZoneShape::Capsule)
+			{
+				zone.end.x = std::stof(fields[5]);
+				zone.end.y = std::stof(fields[6]);
+				zone.end.z = std::stof(fields[7]);
+			}
+			zone.radius = std::stof(fields[expectedFields - 1]);
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+
+		return zone.radius > 0.0f;
+	}
+
     void loadConfig() 
     {
 		std::string runtimeDirectory = GetRuntimeDirectory();
@@ -68,6 +146,8 @@ namespace InteractivePipeSmokingVR {
 				std::string line;
 				std::string currentSection;
 
+				configZones.clear();
+
 				while (std::getline(file, line)) 
 				{
 					trim(line);
@@ -85,6 +165,25 @@ namespace InteractivePipeSmokingVR {
 							trim(currentSection);       
 						}
 					}
+					else if (currentSection == "Zones")
+					{
+						std::string zoneName;
+						std::string zoneValueStr = GetConfigSettingsStringValue(line, zoneName);
+
+						ZoneDefinition zone;
+						if (zoneName.empty() || _stricmp(zoneName.c_str(), ZONE_LIPS_NAME) == 0)
+						{
+							_MESSAGE("[Zones] WARNING: Zone name '%s' is reserved or empty - use the FaceZone settings for the lips zone", zoneName.c_str());
+						}
+						else if (!ParseZoneDefinition(zoneName, zoneValueStr, zone))
+						{
+							_MESSAGE("[Zones] WARNING: Could not parse zone '%s' (expected Head|Body, Sphere|Capsule, offsets, radius > 0)", zoneName.c_str());
+						}
+						else
+						{
+							configZones.push_back(zone);
+						}
+					}
 					else if (currentSection == "Settings") 
 					{
 						std::string variableName;
@@ -110,6 +209,18 @@ namespace InteractivePipeSmokingVR {
 						{
 							configFaceZoneRadius = std::stof(variableValueStr);
 						}
+						else if (variableName == "ZoneHysteresis")
+						{
+							configZoneHysteresis = std::stof(variableValueStr);
+						}
+						else if (variableName == "PositionFilterMinCutoff")
+						{
+							configPositionFilterMinCutoff = std::stof(variableValueStr);
+						}
+						else if (variableName == "PositionFilterBeta")
+						{
+							configPositionFilterBeta = std::stof(variableValueStr);
+						}
 						else if (variableName == "ControllerTouchRadius")
 						{
 							configControllerTouchRadius = std::stof(variableValueStr);
@@ -134,6 +245,22 @@ namespace InteractivePipeSmokingVR {
 						{
 							configNearClipRestoreDelayMs = std::stoi(variableValueStr);
 						}
+						else if (variableName == "TrackingMode")
+						{
+							configTrackingMode = std::stoi(variableValueStr);
+						}
+						else if (variableName == "TrackingClockPolicy")
+						{
+							configTrackingClockPolicy = std::stoi(variableValueStr);
+						}
+						else if (variableName == "PredictiveZoneEntry")
+						{
+							configPredictiveZoneEntry = std::stoi(variableValueStr);
+						}
+						else if (variableName == "PredictiveLookAheadMs")
+						{
+							configPredictiveLookAheadMs = std::stoi(variableValueStr);
+						}
 						else if (variableName == "SmokableGrabbedScale")
 						{
 							configSmokableGrabbedScale = std::stof(variableValueStr);
@@ -16,6 +16,7 @@
 #include "higgsinterface001.h"
 #include "vrikinterface001.h"
 #include "SkyrimVRESLAPI.h"
+#include "ZoneRegistry.h"
 
 namespace InteractivePipeSmokingVR {
 
@@ -32,6 +33,18 @@ namespace InteractivePipeSmokingVR {
 	extern float configFaceZoneOffsetZ;  // Up/Down offset (negative = down towards lips)
 	extern float configFaceZoneRadius;   // Detection radius
 
+	// Additional interaction zones from the [Zones] section (the lips zone comes from the FaceZone settings):
+	//   Name = Head|Body, Sphere, X, Y, Z, Radius
+	//   Name = Head|Body, Capsule, X1, Y1, Z1, X2, Y2, Z2, Radius
+	extern std::vector<ZoneDefinition> configZones;
+
+	// Hysteresis for every zone/radius test: a hand inside stays inside until it is this much further out (game units)
+	extern float configZoneHysteresis;
+
+	// One Euro filter on the tracked positions (removes jitter at rest, little lag in fast motion)
+	extern float configPositionFilterMinCutoff;  // Cutoff at rest in Hz (0 = no filtering)
+	extern float configPositionFilterBeta;       // Cutoff increase per game unit/second of speed
+
 	// Controller touch detection
 	extern float configControllerTouchRadius;  // Distance threshold for controllers "touching"
 	extern float configRolledSmokeLightingRadius;  // Larger distance for rolled smoke ignition with flames
@@ -42,6 +55,20 @@ namespace InteractivePipeSmokingVR {
 	// Near clip restore delay (milliseconds)
 	extern int configNearClipRestoreDelayMs;
 
+	// VR tracking mode (0 = timer, 10 updates per second; 1 = frame-locked, runs from the HIGGS per-frame callback;
+	// 2 = adaptive, frame-driven but the update rate follows how close the hands are to a detection boundary)
+	extern int configTrackingMode;
+
+	// Timer mode clock policy when the tracker falls a full period behind (0 = skip missed ticks, 1 = catch up)
+	extern int configTrackingClockPolicy;
+
+	// Predictive face zone entry (0 = off, 1 = on): a controller heading for the lips is flagged as near face
+	// once its position extrapolated along its velocity is inside the zone, hiding one update of tracking latency
+	extern int configPredictiveZoneEntry;
+
+	// How far ahead to extrapolate in milliseconds (0 = the measured interval between tracker updates)
+	extern int configPredictiveLookAheadMs;
+
 	// Smokable ingredient scale when grabbed with empty pipe equipped (0.35 = 35% of original, 65% reduction)
 	extern float configSmokableGrabbedScale;
 